@@ -5,8 +5,7 @@
 
 #include <array>
 #include <algorithm>
-#include <exception>
-#include <map>
+#include <cstdint>
 #include <utility>
 #include <vector>
 
@@ -19,10 +18,7 @@ std::pair<unsigned int, std::vector<unsigned int>> algo_dynamic::run() {
     return std::make_pair(0, std::vector<unsigned int>());
   }
 
-  std::array<unsigned int, transitions::k_finger_count> sub_results;
-  for (unsigned int f = 0; f < transitions::k_finger_count; f++) {
-    sub_results[f] = find_min(0, f);
-  }
+  auto sub_results = find_min();
 
   int best = std::min_element(sub_results.begin(), sub_results.end()) - sub_results.begin();
   auto fingers = get_finger_list(best);
@@ -30,49 +26,49 @@ std::pair<unsigned int, std::vector<unsigned int>> algo_dynamic::run() {
   return std::make_pair(sub_results[best], fingers);
 }
 
-unsigned int algo_dynamic::find_min(unsigned int note_index, unsigned int current_finger) {
-  if (note_index == notes_.size()-1) {
-    return 0;
-  }
-
-  auto key = std::make_pair(note_index, current_finger);
-  auto it = results_.find(key);
-  if (it != results_.end()) {
-    return it->second.first;
-  }
-
-  std::array<unsigned int, transitions::k_finger_count> sub_results;
-  for (unsigned int next_finger = 0; next_finger < transitions::k_finger_count; next_finger++) {
-    auto n1 = notes_[note_index];
-    auto n2 = notes_[note_index+1];
-    if (!n1 || !n2) {
-      throw std::runtime_error("unexpected missing note");
+// costs of playing the song from its first note with each finger, computed
+// from the last note backward so that only the costs of the following note
+// are kept, ties going to the lowest next finger
+algo_dynamic::costs algo_dynamic::find_min() {
+  const auto& values = notes_.get_values();
+  next_fingers_.assign((values.size() - 1) * transitions::k_finger_count, 0);
+
+  costs next_costs{};
+  costs current_costs;
+
+  for (auto note_index = values.size() - 1; note_index-- > 0;) {
+    auto n1 = values[note_index];
+    auto n2 = values[note_index + 1];
+
+    for (unsigned int current_finger = 0; current_finger < transitions::k_finger_count; current_finger++) {
+      unsigned int best = 0;
+      unsigned int best_cost = transitions_.cost(n1, current_finger, n2, 0) + next_costs[0];
+
+      for (unsigned int next_finger = 1; next_finger < transitions::k_finger_count; next_finger++) {
+        unsigned int cost = transitions_.cost(n1, current_finger, n2, next_finger) + next_costs[next_finger];
+        if (cost < best_cost) {
+          best = next_finger;
+          best_cost = cost;
+        }
+      }
+
+      current_costs[current_finger] = best_cost;
+      next_fingers_[note_index * transitions::k_finger_count + current_finger] = best;
     }
 
-    sub_results[next_finger] = transitions_.cost(*n1, current_finger, *n2, next_finger) + find_min(note_index + 1, next_finger);
+    next_costs = current_costs;
   }
 
-  int best = std::min_element(sub_results.begin(), sub_results.end()) - sub_results.begin();
-  auto value = std::make_pair(sub_results[best], best);
-  if (!results_.emplace(key, value).second) {
-    throw std::runtime_error("key already exists in the map");
-  }
-
-  return value.first;
+  return next_costs;
 }
 
 std::vector<unsigned int> algo_dynamic::get_finger_list(unsigned int current_finger) const {
   auto fingers = std::vector<unsigned int>();
+  fingers.reserve(notes_.size());
   fingers.push_back(current_finger);
 
-  for (unsigned int note_index = 0; note_index < notes_.size() - 1; note_index++) {
-    auto key = std::make_pair(note_index, current_finger);
-    auto it = results_.find(key);
-    if (it == results_.end()) {
-      throw std::runtime_error("key not found");
-    }
-
-    current_finger = it->second.second;
+  for (std::size_t note_index = 0; note_index < notes_.size() - 1; note_index++) {
+    current_finger = next_fingers_[note_index * transitions::k_finger_count + current_finger];
     fingers.push_back(current_finger);
   }
 
@@ -5,7 +5,8 @@
 #include <notes.hpp>
 #include <transitions.hpp>
 
-#include <map>
+#include <array>
+#include <cstdint>
 #include <utility>
 #include <vector>
 
@@ -16,9 +17,13 @@ class algo_dynamic : public algo  {
     algo_dynamic(notes n, transitions t);
     std::pair<unsigned int, std::vector<unsigned int>> run() override;
   private:
-    unsigned int find_min(unsigned int note_index, unsigned int current_finger);
+    using costs = std::array<unsigned int, transitions::k_finger_count>;
+
+    costs find_min();
     std::vector<unsigned int> get_finger_list(unsigned int current_finger) const;
-    std::map<std::pair<unsigned int, unsigned int>, std::pair<unsigned int, unsigned int>> results_;
+
+    // best next finger of each note and finger, note_index * k_finger_count + finger
+    std::vector<std::uint8_t> next_fingers_;
 };
 
 } /* namespace tp */
@@ -0,0 +1,182 @@
+#include <algo.hpp>
+#include <algo_parallel.hpp>
+#include <notes.hpp>
+#include <transitions.hpp>
+
+#include <array>
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace tp {
+
+static
+void run_threads(std::size_t count, const std::function<void(std::size_t)>& task) {
+  std::vector<std::thread> threads;
+  for (std::size_t k = 1; k < count; k++) {
+    threads.emplace_back(task, k);
+  }
+
+  task(0);
+
+  for (auto& thread : threads) {
+    thread.join();
+  }
+}
+
+algo_parallel::algo_parallel(notes n, transitions t, unsigned int threads)
+  : algo(n, t), threads_(std::max(threads, 1u)) {}
+
+std::pair<unsigned int, std::vector<unsigned int>> algo_parallel::run() {
+  const auto& values = notes_.get_values();
+  if (values.size() < 2) {
+    return std::make_pair(0, std::vector<unsigned int>());
+  }
+
+  // chunk k covers the transitions from note bounds[k] to note bounds[k+1]
+  std::size_t transition_count = values.size() - 1;
+  std::size_t chunk_count = std::clamp<std::size_t>(transition_count / k_min_chunk, 1, threads_);
+  std::vector<std::size_t> bounds(chunk_count + 1);
+  for (std::size_t k = 0; k <= chunk_count; k++) {
+    bounds[k] = transition_count * k / chunk_count;
+  }
+
+  costs_.resize(transition_count);
+  next_fingers_.assign(transition_count * transitions::k_finger_count, 0);
+
+  run_threads(chunk_count, [&] (std::size_t k) {
+    chunk_costs(bounds[k], bounds[k + 1]);
+  });
+
+  // the last chunk ends the song so its zero end costs are the true ones, each
+  // chunk before it is repaired from the true costs at its end, which are the
+  // costs at the beginning of the next chunk plus that chunk's shift
+  std::vector<unsigned int> shifts(chunk_count, 0);
+  for (std::size_t k = chunk_count - 1; k-- > 0;) {
+    costs end_costs = costs_[bounds[k + 1]];
+    for (auto& cost : end_costs) {
+      cost += shifts[k + 1];
+    }
+
+    shifts[k] = chunk_repair(bounds[k], bounds[k + 1], end_costs);
+  }
+
+  costs first_costs = costs_[0];
+  for (auto& cost : first_costs) {
+    cost += shifts[0];
+  }
+
+  int best = std::min_element(first_costs.begin(), first_costs.end()) - first_costs.begin();
+
+  std::vector<fingers> exits(chunk_count);
+  run_threads(chunk_count, [&] (std::size_t k) {
+    exits[k] = chunk_exits(bounds[k], bounds[k + 1]);
+  });
+
+  std::vector<unsigned int> entries(chunk_count + 1);
+  entries[0] = best;
+  for (std::size_t k = 0; k < chunk_count; k++) {
+    entries[k + 1] = exits[k][entries[k]];
+  }
+
+  std::vector<unsigned int> result(values.size());
+  run_threads(chunk_count, [&] (std::size_t k) {
+    chunk_fingers(bounds[k], bounds[k + 1], entries[k], result);
+  });
+  result.back() = entries[chunk_count];
+
+  return std::make_pair(first_costs[best], result);
+}
+
+// one step of the recurrence of algo_dynamic, from the costs of the note after
+// note_index to its own, ties going to the lowest next finger
+algo_parallel::costs algo_parallel::step(std::size_t note_index, const costs& next_costs) {
+  const auto& values = notes_.get_values();
+  auto n1 = values[note_index];
+  auto n2 = values[note_index + 1];
+
+  costs current_costs;
+  for (unsigned int current_finger = 0; current_finger < transitions::k_finger_count; current_finger++) {
+    unsigned int best = 0;
+    unsigned int best_cost = transitions_.cost(n1, current_finger, n2, 0) + next_costs[0];
+
+    for (unsigned int next_finger = 1; next_finger < transitions::k_finger_count; next_finger++) {
+      unsigned int cost = transitions_.cost(n1, current_finger, n2, next_finger) + next_costs[next_finger];
+      if (cost < best_cost) {
+        best = next_finger;
+        best_cost = cost;
+      }
+    }
+
+    current_costs[current_finger] = best_cost;
+    next_fingers_[note_index * transitions::k_finger_count + current_finger] = best;
+  }
+
+  return current_costs;
+}
+
+void algo_parallel::chunk_costs(std::size_t begin, std::size_t end) {
+  costs next_costs{};
+  for (auto note_index = end; note_index-- > begin;) {
+    next_costs = step(note_index, next_costs);
+    costs_[note_index] = next_costs;
+  }
+}
+
+// reruns the recurrence from the true end costs until the costs of a note are
+// the ones found from zero end costs plus a constant, from there on every
+// cost is shifted by that constant and every best finger is already right.
+// Returns the constant, or 0 when the whole chunk had to be rerun
+unsigned int algo_parallel::chunk_repair(std::size_t begin, std::size_t end, const costs& end_costs) {
+  costs next_costs = end_costs;
+  for (auto note_index = end; note_index-- > begin;) {
+    next_costs = step(note_index, next_costs);
+
+    // the true end costs are at least zero, so are the shifts
+    const auto& guessed = costs_[note_index];
+    unsigned int shift = next_costs[0] - guessed[0];
+    bool converged = true;
+    for (unsigned int f = 1; f < transitions::k_finger_count; f++) {
+      converged &= next_costs[f] - guessed[f] == shift;
+    }
+
+    if (converged) {
+      return shift;
+    }
+
+    costs_[note_index] = next_costs;
+  }
+
+  return 0;
+}
+
+// the finger each finger on note begin leads to on note end
+algo_parallel::fingers algo_parallel::chunk_exits(std::size_t begin, std::size_t end) const {
+  fingers exits;
+  for (unsigned int f = 0; f < transitions::k_finger_count; f++) {
+    exits[f] = f;
+  }
+
+  for (std::size_t note_index = begin; note_index < end; note_index++) {
+    for (auto& exit : exits) {
+      exit = next_fingers_[note_index * transitions::k_finger_count + exit];
+    }
+  }
+
+  return exits;
+}
+
+void algo_parallel::chunk_fingers(std::size_t begin, std::size_t end, unsigned int entry,
+                                  std::vector<unsigned int>& result) const {
+  unsigned int current_finger = entry;
+  for (std::size_t note_index = begin; note_index < end; note_index++) {
+    result[note_index] = current_finger;
+    current_finger = next_fingers_[note_index * transitions::k_finger_count + current_finger];
+  }
+}
+
+} /* namespace tp */
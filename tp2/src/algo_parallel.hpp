@@ -0,0 +1,49 @@
+#ifndef INCLUDE_ALGO_PARALLEL_HPP
+#define INCLUDE_ALGO_PARALLEL_HPP
+
+#include <algo.hpp>
+#include <notes.hpp>
+#include <transitions.hpp>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+namespace tp {
+
+/*
+ * Same dynamic programming as algo_dynamic, split into chunks of notes solved
+ * by separate threads. Each chunk runs the recurrence from zero costs at its
+ * end rather than the costs of the chunks after it. A few notes before its
+ * end, the costs of a chunk only differ from the true ones by a constant,
+ * which leaves the best fingers unchanged, so a sequential pass only has to
+ * recompute the last notes of each chunk from the true costs until they
+ * agree.
+ */
+class algo_parallel : public algo  {
+  public:
+    algo_parallel(notes n, transitions t, unsigned int threads);
+    std::pair<unsigned int, std::vector<unsigned int>> run() override;
+  private:
+    static const std::size_t k_min_chunk = 1 << 14;
+
+    using costs = std::array<unsigned int, transitions::k_finger_count>;
+    using fingers = std::array<std::uint8_t, transitions::k_finger_count>;
+
+    costs step(std::size_t note_index, const costs& next_costs);
+    void chunk_costs(std::size_t begin, std::size_t end);
+    unsigned int chunk_repair(std::size_t begin, std::size_t end, const costs& end_costs);
+    fingers chunk_exits(std::size_t begin, std::size_t end) const;
+    void chunk_fingers(std::size_t begin, std::size_t end, unsigned int entry, std::vector<unsigned int>& result) const;
+
+    unsigned int threads_;
+    // costs of playing each note with each finger until the end of its chunk
+    std::vector<costs> costs_;
+    std::vector<std::uint8_t> next_fingers_;
+};
+
+} /* namespace tp */
+
+#endif /* INCLUDE_ALGO_PARALLEL_HPP */
@@ -1,5 +1,6 @@
 #include <algo_greedy.hpp>
 #include <algo_dynamic.hpp>
+#include <algo_parallel.hpp>
 #include <algo_search.hpp>
 #include <transitions.hpp>
 #include <notes.hpp>
@@ -10,6 +11,7 @@
 #include <cstring>
 #include <iostream>
 #include <optional>
+#include <thread>
 #include <vector>
 
 static
@@ -27,11 +29,13 @@ void show_help(FILE* f, const char* exec_name) {
   fprintf(f, "\n");
   fprintf(f, "  --greedy           use greedy algorithm [DEFAULT]\n");
   fprintf(f, "  --dynamic          use dynamic programming algorithm\n");
+  fprintf(f, "  --parallel         use dynamic programming algorithm split across threads\n");
   fprintf(f, "  --search           use neighbors searching algorithm\n");
   fprintf(f, "  --benchmark        print execution time in milliseconds\n");
   fprintf(f, "  --solution         print computed solution\n");
   fprintf(f, "  --cost             print solution's cost\n");
   fprintf(f, "  --iterations N     the number of iterations for searching algorithm\n");
+  fprintf(f, "  --threads N        the number of threads for parallel algorithm [DEFAULT cores]\n");
   fprintf(f, "  --song FILE        the song file to run the algorithm\n");
   fprintf(f, "  --keys FILE        the transitions cost file to run the algorithm\n");
   fprintf(f, "  --help             show this help\n");
@@ -84,12 +88,14 @@ int main(int argc, char** argv) {
 
   bool use_greedy = false;
   bool use_dynamic = false;
+  bool use_parallel = false;
   bool use_search = false;
   bool print_benchmark = false;
   bool print_solution = false;
   bool print_cost = false;
   int use_opt_count = 0;
   int iterations = 10000;
+  int threads = std::thread::hardware_concurrency();
   std::string file_song = "songs/fur_elise.txt";
   std::string file_transitions = "cout_transition.txt";
 
@@ -101,6 +107,9 @@ int main(int argc, char** argv) {
     } else if (strcmp("--dynamic", argv[i]) == 0) {
       use_dynamic = true;
       use_opt_count++;
+    } else if (strcmp("--parallel", argv[i]) == 0) {
+      use_parallel = true;
+      use_opt_count++;
     } else if (strcmp("--search", argv[i]) == 0) {
       use_search = true;
       use_opt_count++;
@@ -120,6 +129,16 @@ int main(int argc, char** argv) {
       if (iterations < 0) {
         fail_negative_arg(exec_name, argv[i-1]);
       }
+    } else if (strcmp("--threads", argv[i]) == 0) {
+      if (i >= argc - 1) {
+        fail_missing_arg(exec_name, argv[i]);
+      }
+
+      threads = std::stoi(std::string(argv[++i]));
+
+      if (threads < 0) {
+        fail_negative_arg(exec_name, argv[i-1]);
+      }
     } else if (strcmp("--song", argv[i]) == 0) {
       if (i > argc - 1) {
         fail_missing_arg(exec_name, argv[i]);
@@ -166,6 +185,10 @@ int main(int argc, char** argv) {
     algo = new tp::algo_dynamic(*notes, *transitions);
   }
 
+  if (use_parallel) {
+    algo = new tp::algo_parallel(*notes, *transitions, threads);
+  }
+
   if (use_search) {
     algo = new tp::algo_search(*notes, *transitions, iterations);
   }
@@ -10,6 +10,9 @@ get_algo_cmd() {
     dp)
         printf "%s" "--dynamic"
         ;;
+    dp_parallele)
+        printf "%s" "--parallel"
+        ;;
     heuristique)
         printf "%s" "--search"
         ;;
@@ -0,0 +1,45 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/tp3/source/algorithm.cpp" "CMakeFiles/pandemic.dir/source/algorithm.cpp.o" "gcc" "CMakeFiles/pandemic.dir/source/algorithm.cpp.o.d"
+  "/root/repo/tp3/source/algorithm_anneal.cpp" "CMakeFiles/pandemic.dir/source/algorithm_anneal.cpp.o" "gcc" "CMakeFiles/pandemic.dir/source/algorithm_anneal.cpp.o.d"
+  "/root/repo/tp3/source/algorithm_basic.cpp" "CMakeFiles/pandemic.dir/source/algorithm_basic.cpp.o" "gcc" "CMakeFiles/pandemic.dir/source/algorithm_basic.cpp.o.d"
+  "/root/repo/tp3/source/algorithm_components.cpp" "CMakeFiles/pandemic.dir/source/algorithm_components.cpp.o" "gcc" "CMakeFiles/pandemic.dir/source/algorithm_components.cpp.o.d"
+  "/root/repo/tp3/source/algorithm_greedy.cpp" "CMakeFiles/pandemic.dir/source/algorithm_greedy.cpp.o" "gcc" "CMakeFiles/pandemic.dir/source/algorithm_greedy.cpp.o.d"
+  "/root/repo/tp3/source/batch.cpp" "CMakeFiles/pandemic.dir/source/batch.cpp.o" "gcc" "CMakeFiles/pandemic.dir/source/batch.cpp.o.d"
+  "/root/repo/tp3/source/benchmark.cpp" "CMakeFiles/pandemic.dir/source/benchmark.cpp.o" "gcc" "CMakeFiles/pandemic.dir/source/benchmark.cpp.o.d"
+  "/root/repo/tp3/source/chromosome.cpp" "CMakeFiles/pandemic.dir/source/chromosome.cpp.o" "gcc" "CMakeFiles/pandemic.dir/source/chromosome.cpp.o.d"
+  "/root/repo/tp3/source/chromosome_parallel.cpp" "CMakeFiles/pandemic.dir/source/chromosome_parallel.cpp.o" "gcc" "CMakeFiles/pandemic.dir/source/chromosome_parallel.cpp.o.d"
+  "/root/repo/tp3/source/contagion.cpp" "CMakeFiles/pandemic.dir/source/contagion.cpp.o" "gcc" "CMakeFiles/pandemic.dir/source/contagion.cpp.o.d"
+  "/root/repo/tp3/source/criteria.cpp" "CMakeFiles/pandemic.dir/source/criteria.cpp.o" "gcc" "CMakeFiles/pandemic.dir/source/criteria.cpp.o.d"
+  "/root/repo/tp3/source/differential.cpp" "CMakeFiles/pandemic.dir/source/differential.cpp.o" "gcc" "CMakeFiles/pandemic.dir/source/differential.cpp.o.d"
+  "/root/repo/tp3/source/engine.cpp" "CMakeFiles/pandemic.dir/source/engine.cpp.o" "gcc" "CMakeFiles/pandemic.dir/source/engine.cpp.o.d"
+  "/root/repo/tp3/source/isolation_bound.cpp" "CMakeFiles/pandemic.dir/source/isolation_bound.cpp.o" "gcc" "CMakeFiles/pandemic.dir/source/isolation_bound.cpp.o.d"
+  "/root/repo/tp3/source/main.cpp" "CMakeFiles/pandemic.dir/source/main.cpp.o" "gcc" "CMakeFiles/pandemic.dir/source/main.cpp.o.d"
+  "/root/repo/tp3/source/memory.cpp" "CMakeFiles/pandemic.dir/source/memory.cpp.o" "gcc" "CMakeFiles/pandemic.dir/source/memory.cpp.o.d"
+  "/root/repo/tp3/source/operator_rates.cpp" "CMakeFiles/pandemic.dir/source/operator_rates.cpp.o" "gcc" "CMakeFiles/pandemic.dir/source/operator_rates.cpp.o.d"
+  "/root/repo/tp3/source/population.cpp" "CMakeFiles/pandemic.dir/source/population.cpp.o" "gcc" "CMakeFiles/pandemic.dir/source/population.cpp.o.d"
+  "/root/repo/tp3/source/printer.cpp" "CMakeFiles/pandemic.dir/source/printer.cpp.o" "gcc" "CMakeFiles/pandemic.dir/source/printer.cpp.o.d"
+  "/root/repo/tp3/source/relation_set.cpp" "CMakeFiles/pandemic.dir/source/relation_set.cpp.o" "gcc" "CMakeFiles/pandemic.dir/source/relation_set.cpp.o.d"
+  "/root/repo/tp3/source/server.cpp" "CMakeFiles/pandemic.dir/source/server.cpp.o" "gcc" "CMakeFiles/pandemic.dir/source/server.cpp.o.d"
+  "/root/repo/tp3/source/settings.cpp" "CMakeFiles/pandemic.dir/source/settings.cpp.o" "gcc" "CMakeFiles/pandemic.dir/source/settings.cpp.o.d"
+  "/root/repo/tp3/source/solution.cpp" "CMakeFiles/pandemic.dir/source/solution.cpp.o" "gcc" "CMakeFiles/pandemic.dir/source/solution.cpp.o.d"
+  "/root/repo/tp3/source/solution_sink.cpp" "CMakeFiles/pandemic.dir/source/solution_sink.cpp.o" "gcc" "CMakeFiles/pandemic.dir/source/solution_sink.cpp.o.d"
+  "/root/repo/tp3/source/statistics.cpp" "CMakeFiles/pandemic.dir/source/statistics.cpp.o" "gcc" "CMakeFiles/pandemic.dir/source/statistics.cpp.o.d"
+  "/root/repo/tp3/source/thread_pinning.cpp" "CMakeFiles/pandemic.dir/source/thread_pinning.cpp.o" "gcc" "CMakeFiles/pandemic.dir/source/thread_pinning.cpp.o.d"
+  "/root/repo/tp3/source/trace.cpp" "CMakeFiles/pandemic.dir/source/trace.cpp.o" "gcc" "CMakeFiles/pandemic.dir/source/trace.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,63 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/pandemic.dir/source/algorithm.cpp.o"
+  "CMakeFiles/pandemic.dir/source/algorithm.cpp.o.d"
+  "CMakeFiles/pandemic.dir/source/algorithm_anneal.cpp.o"
+  "CMakeFiles/pandemic.dir/source/algorithm_anneal.cpp.o.d"
+  "CMakeFiles/pandemic.dir/source/algorithm_basic.cpp.o"
+  "CMakeFiles/pandemic.dir/source/algorithm_basic.cpp.o.d"
+  "CMakeFiles/pandemic.dir/source/algorithm_components.cpp.o"
+  "CMakeFiles/pandemic.dir/source/algorithm_components.cpp.o.d"
+  "CMakeFiles/pandemic.dir/source/algorithm_greedy.cpp.o"
+  "CMakeFiles/pandemic.dir/source/algorithm_greedy.cpp.o.d"
+  "CMakeFiles/pandemic.dir/source/batch.cpp.o"
+  "CMakeFiles/pandemic.dir/source/batch.cpp.o.d"
+  "CMakeFiles/pandemic.dir/source/benchmark.cpp.o"
+  "CMakeFiles/pandemic.dir/source/benchmark.cpp.o.d"
+  "CMakeFiles/pandemic.dir/source/chromosome.cpp.o"
+  "CMakeFiles/pandemic.dir/source/chromosome.cpp.o.d"
+  "CMakeFiles/pandemic.dir/source/chromosome_parallel.cpp.o"
+  "CMakeFiles/pandemic.dir/source/chromosome_parallel.cpp.o.d"
+  "CMakeFiles/pandemic.dir/source/contagion.cpp.o"
+  "CMakeFiles/pandemic.dir/source/contagion.cpp.o.d"
+  "CMakeFiles/pandemic.dir/source/criteria.cpp.o"
+  "CMakeFiles/pandemic.dir/source/criteria.cpp.o.d"
+  "CMakeFiles/pandemic.dir/source/differential.cpp.o"
+  "CMakeFiles/pandemic.dir/source/differential.cpp.o.d"
+  "CMakeFiles/pandemic.dir/source/engine.cpp.o"
+  "CMakeFiles/pandemic.dir/source/engine.cpp.o.d"
+  "CMakeFiles/pandemic.dir/source/isolation_bound.cpp.o"
+  "CMakeFiles/pandemic.dir/source/isolation_bound.cpp.o.d"
+  "CMakeFiles/pandemic.dir/source/main.cpp.o"
+  "CMakeFiles/pandemic.dir/source/main.cpp.o.d"
+  "CMakeFiles/pandemic.dir/source/memory.cpp.o"
+  "CMakeFiles/pandemic.dir/source/memory.cpp.o.d"
+  "CMakeFiles/pandemic.dir/source/operator_rates.cpp.o"
+  "CMakeFiles/pandemic.dir/source/operator_rates.cpp.o.d"
+  "CMakeFiles/pandemic.dir/source/population.cpp.o"
+  "CMakeFiles/pandemic.dir/source/population.cpp.o.d"
+  "CMakeFiles/pandemic.dir/source/printer.cpp.o"
+  "CMakeFiles/pandemic.dir/source/printer.cpp.o.d"
+  "CMakeFiles/pandemic.dir/source/relation_set.cpp.o"
+  "CMakeFiles/pandemic.dir/source/relation_set.cpp.o.d"
+  "CMakeFiles/pandemic.dir/source/server.cpp.o"
+  "CMakeFiles/pandemic.dir/source/server.cpp.o.d"
+  "CMakeFiles/pandemic.dir/source/settings.cpp.o"
+  "CMakeFiles/pandemic.dir/source/settings.cpp.o.d"
+  "CMakeFiles/pandemic.dir/source/solution.cpp.o"
+  "CMakeFiles/pandemic.dir/source/solution.cpp.o.d"
+  "CMakeFiles/pandemic.dir/source/solution_sink.cpp.o"
+  "CMakeFiles/pandemic.dir/source/solution_sink.cpp.o.d"
+  "CMakeFiles/pandemic.dir/source/statistics.cpp.o"
+  "CMakeFiles/pandemic.dir/source/statistics.cpp.o.d"
+  "CMakeFiles/pandemic.dir/source/thread_pinning.cpp.o"
+  "CMakeFiles/pandemic.dir/source/thread_pinning.cpp.o.d"
+  "CMakeFiles/pandemic.dir/source/trace.cpp.o"
+  "CMakeFiles/pandemic.dir/source/trace.cpp.o.d"
+  "pandemic"
+  "pandemic.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/pandemic.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,63 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/pandemic_bench.dir/source/algorithm.cpp.o"
+  "CMakeFiles/pandemic_bench.dir/source/algorithm.cpp.o.d"
+  "CMakeFiles/pandemic_bench.dir/source/algorithm_anneal.cpp.o"
+  "CMakeFiles/pandemic_bench.dir/source/algorithm_anneal.cpp.o.d"
+  "CMakeFiles/pandemic_bench.dir/source/algorithm_basic.cpp.o"
+  "CMakeFiles/pandemic_bench.dir/source/algorithm_basic.cpp.o.d"
+  "CMakeFiles/pandemic_bench.dir/source/algorithm_components.cpp.o"
+  "CMakeFiles/pandemic_bench.dir/source/algorithm_components.cpp.o.d"
+  "CMakeFiles/pandemic_bench.dir/source/algorithm_greedy.cpp.o"
+  "CMakeFiles/pandemic_bench.dir/source/algorithm_greedy.cpp.o.d"
+  "CMakeFiles/pandemic_bench.dir/source/batch.cpp.o"
+  "CMakeFiles/pandemic_bench.dir/source/batch.cpp.o.d"
+  "CMakeFiles/pandemic_bench.dir/source/bench.cpp.o"
+  "CMakeFiles/pandemic_bench.dir/source/bench.cpp.o.d"
+  "CMakeFiles/pandemic_bench.dir/source/benchmark.cpp.o"
+  "CMakeFiles/pandemic_bench.dir/source/benchmark.cpp.o.d"
+  "CMakeFiles/pandemic_bench.dir/source/chromosome.cpp.o"
+  "CMakeFiles/pandemic_bench.dir/source/chromosome.cpp.o.d"
+  "CMakeFiles/pandemic_bench.dir/source/chromosome_parallel.cpp.o"
+  "CMakeFiles/pandemic_bench.dir/source/chromosome_parallel.cpp.o.d"
+  "CMakeFiles/pandemic_bench.dir/source/contagion.cpp.o"
+  "CMakeFiles/pandemic_bench.dir/source/contagion.cpp.o.d"
+  "CMakeFiles/pandemic_bench.dir/source/criteria.cpp.o"
+  "CMakeFiles/pandemic_bench.dir/source/criteria.cpp.o.d"
+  "CMakeFiles/pandemic_bench.dir/source/differential.cpp.o"
+  "CMakeFiles/pandemic_bench.dir/source/differential.cpp.o.d"
+  "CMakeFiles/pandemic_bench.dir/source/engine.cpp.o"
+  "CMakeFiles/pandemic_bench.dir/source/engine.cpp.o.d"
+  "CMakeFiles/pandemic_bench.dir/source/isolation_bound.cpp.o"
+  "CMakeFiles/pandemic_bench.dir/source/isolation_bound.cpp.o.d"
+  "CMakeFiles/pandemic_bench.dir/source/memory.cpp.o"
+  "CMakeFiles/pandemic_bench.dir/source/memory.cpp.o.d"
+  "CMakeFiles/pandemic_bench.dir/source/operator_rates.cpp.o"
+  "CMakeFiles/pandemic_bench.dir/source/operator_rates.cpp.o.d"
+  "CMakeFiles/pandemic_bench.dir/source/population.cpp.o"
+  "CMakeFiles/pandemic_bench.dir/source/population.cpp.o.d"
+  "CMakeFiles/pandemic_bench.dir/source/printer.cpp.o"
+  "CMakeFiles/pandemic_bench.dir/source/printer.cpp.o.d"
+  "CMakeFiles/pandemic_bench.dir/source/relation_set.cpp.o"
+  "CMakeFiles/pandemic_bench.dir/source/relation_set.cpp.o.d"
+  "CMakeFiles/pandemic_bench.dir/source/server.cpp.o"
+  "CMakeFiles/pandemic_bench.dir/source/server.cpp.o.d"
+  "CMakeFiles/pandemic_bench.dir/source/settings.cpp.o"
+  "CMakeFiles/pandemic_bench.dir/source/settings.cpp.o.d"
+  "CMakeFiles/pandemic_bench.dir/source/solution.cpp.o"
+  "CMakeFiles/pandemic_bench.dir/source/solution.cpp.o.d"
+  "CMakeFiles/pandemic_bench.dir/source/solution_sink.cpp.o"
+  "CMakeFiles/pandemic_bench.dir/source/solution_sink.cpp.o.d"
+  "CMakeFiles/pandemic_bench.dir/source/statistics.cpp.o"
+  "CMakeFiles/pandemic_bench.dir/source/statistics.cpp.o.d"
+  "CMakeFiles/pandemic_bench.dir/source/thread_pinning.cpp.o"
+  "CMakeFiles/pandemic_bench.dir/source/thread_pinning.cpp.o.d"
+  "CMakeFiles/pandemic_bench.dir/source/trace.cpp.o"
+  "CMakeFiles/pandemic_bench.dir/source/trace.cpp.o.d"
+  "pandemic_bench"
+  "pandemic_bench.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/pandemic_bench.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
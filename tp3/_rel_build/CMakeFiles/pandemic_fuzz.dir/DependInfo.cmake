@@ -0,0 +1,23 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/tp3/source/contagion.cpp" "CMakeFiles/pandemic_fuzz.dir/source/contagion.cpp.o" "gcc" "CMakeFiles/pandemic_fuzz.dir/source/contagion.cpp.o.d"
+  "/root/repo/tp3/source/differential.cpp" "CMakeFiles/pandemic_fuzz.dir/source/differential.cpp.o" "gcc" "CMakeFiles/pandemic_fuzz.dir/source/differential.cpp.o.d"
+  "/root/repo/tp3/source/fuzz.cpp" "CMakeFiles/pandemic_fuzz.dir/source/fuzz.cpp.o" "gcc" "CMakeFiles/pandemic_fuzz.dir/source/fuzz.cpp.o.d"
+  "/root/repo/tp3/source/population.cpp" "CMakeFiles/pandemic_fuzz.dir/source/population.cpp.o" "gcc" "CMakeFiles/pandemic_fuzz.dir/source/population.cpp.o.d"
+  "/root/repo/tp3/source/relation_set.cpp" "CMakeFiles/pandemic_fuzz.dir/source/relation_set.cpp.o" "gcc" "CMakeFiles/pandemic_fuzz.dir/source/relation_set.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
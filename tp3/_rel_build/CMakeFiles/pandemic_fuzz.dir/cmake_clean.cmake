@@ -0,0 +1,19 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/pandemic_fuzz.dir/source/contagion.cpp.o"
+  "CMakeFiles/pandemic_fuzz.dir/source/contagion.cpp.o.d"
+  "CMakeFiles/pandemic_fuzz.dir/source/differential.cpp.o"
+  "CMakeFiles/pandemic_fuzz.dir/source/differential.cpp.o.d"
+  "CMakeFiles/pandemic_fuzz.dir/source/fuzz.cpp.o"
+  "CMakeFiles/pandemic_fuzz.dir/source/fuzz.cpp.o.d"
+  "CMakeFiles/pandemic_fuzz.dir/source/population.cpp.o"
+  "CMakeFiles/pandemic_fuzz.dir/source/population.cpp.o.d"
+  "CMakeFiles/pandemic_fuzz.dir/source/relation_set.cpp.o"
+  "CMakeFiles/pandemic_fuzz.dir/source/relation_set.cpp.o.d"
+  "pandemic_fuzz"
+  "pandemic_fuzz.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/pandemic_fuzz.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
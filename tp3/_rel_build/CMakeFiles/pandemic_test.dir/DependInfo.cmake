@@ -0,0 +1,65 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/tp3/source/algorithm.cpp" "CMakeFiles/pandemic_test.dir/source/algorithm.cpp.o" "gcc" "CMakeFiles/pandemic_test.dir/source/algorithm.cpp.o.d"
+  "/root/repo/tp3/source/algorithm_anneal.cpp" "CMakeFiles/pandemic_test.dir/source/algorithm_anneal.cpp.o" "gcc" "CMakeFiles/pandemic_test.dir/source/algorithm_anneal.cpp.o.d"
+  "/root/repo/tp3/source/algorithm_basic.cpp" "CMakeFiles/pandemic_test.dir/source/algorithm_basic.cpp.o" "gcc" "CMakeFiles/pandemic_test.dir/source/algorithm_basic.cpp.o.d"
+  "/root/repo/tp3/source/algorithm_components.cpp" "CMakeFiles/pandemic_test.dir/source/algorithm_components.cpp.o" "gcc" "CMakeFiles/pandemic_test.dir/source/algorithm_components.cpp.o.d"
+  "/root/repo/tp3/source/algorithm_greedy.cpp" "CMakeFiles/pandemic_test.dir/source/algorithm_greedy.cpp.o" "gcc" "CMakeFiles/pandemic_test.dir/source/algorithm_greedy.cpp.o.d"
+  "/root/repo/tp3/source/batch.cpp" "CMakeFiles/pandemic_test.dir/source/batch.cpp.o" "gcc" "CMakeFiles/pandemic_test.dir/source/batch.cpp.o.d"
+  "/root/repo/tp3/source/benchmark.cpp" "CMakeFiles/pandemic_test.dir/source/benchmark.cpp.o" "gcc" "CMakeFiles/pandemic_test.dir/source/benchmark.cpp.o.d"
+  "/root/repo/tp3/source/chromosome.cpp" "CMakeFiles/pandemic_test.dir/source/chromosome.cpp.o" "gcc" "CMakeFiles/pandemic_test.dir/source/chromosome.cpp.o.d"
+  "/root/repo/tp3/source/chromosome_parallel.cpp" "CMakeFiles/pandemic_test.dir/source/chromosome_parallel.cpp.o" "gcc" "CMakeFiles/pandemic_test.dir/source/chromosome_parallel.cpp.o.d"
+  "/root/repo/tp3/source/contagion.cpp" "CMakeFiles/pandemic_test.dir/source/contagion.cpp.o" "gcc" "CMakeFiles/pandemic_test.dir/source/contagion.cpp.o.d"
+  "/root/repo/tp3/source/criteria.cpp" "CMakeFiles/pandemic_test.dir/source/criteria.cpp.o" "gcc" "CMakeFiles/pandemic_test.dir/source/criteria.cpp.o.d"
+  "/root/repo/tp3/source/differential.cpp" "CMakeFiles/pandemic_test.dir/source/differential.cpp.o" "gcc" "CMakeFiles/pandemic_test.dir/source/differential.cpp.o.d"
+  "/root/repo/tp3/source/engine.cpp" "CMakeFiles/pandemic_test.dir/source/engine.cpp.o" "gcc" "CMakeFiles/pandemic_test.dir/source/engine.cpp.o.d"
+  "/root/repo/tp3/source/isolation_bound.cpp" "CMakeFiles/pandemic_test.dir/source/isolation_bound.cpp.o" "gcc" "CMakeFiles/pandemic_test.dir/source/isolation_bound.cpp.o.d"
+  "/root/repo/tp3/source/main_test.cpp" "CMakeFiles/pandemic_test.dir/source/main_test.cpp.o" "gcc" "CMakeFiles/pandemic_test.dir/source/main_test.cpp.o.d"
+  "/root/repo/tp3/source/memory.cpp" "CMakeFiles/pandemic_test.dir/source/memory.cpp.o" "gcc" "CMakeFiles/pandemic_test.dir/source/memory.cpp.o.d"
+  "/root/repo/tp3/source/operator_rates.cpp" "CMakeFiles/pandemic_test.dir/source/operator_rates.cpp.o" "gcc" "CMakeFiles/pandemic_test.dir/source/operator_rates.cpp.o.d"
+  "/root/repo/tp3/source/population.cpp" "CMakeFiles/pandemic_test.dir/source/population.cpp.o" "gcc" "CMakeFiles/pandemic_test.dir/source/population.cpp.o.d"
+  "/root/repo/tp3/source/printer.cpp" "CMakeFiles/pandemic_test.dir/source/printer.cpp.o" "gcc" "CMakeFiles/pandemic_test.dir/source/printer.cpp.o.d"
+  "/root/repo/tp3/source/relation_set.cpp" "CMakeFiles/pandemic_test.dir/source/relation_set.cpp.o" "gcc" "CMakeFiles/pandemic_test.dir/source/relation_set.cpp.o.d"
+  "/root/repo/tp3/source/server.cpp" "CMakeFiles/pandemic_test.dir/source/server.cpp.o" "gcc" "CMakeFiles/pandemic_test.dir/source/server.cpp.o.d"
+  "/root/repo/tp3/source/settings.cpp" "CMakeFiles/pandemic_test.dir/source/settings.cpp.o" "gcc" "CMakeFiles/pandemic_test.dir/source/settings.cpp.o.d"
+  "/root/repo/tp3/source/solution.cpp" "CMakeFiles/pandemic_test.dir/source/solution.cpp.o" "gcc" "CMakeFiles/pandemic_test.dir/source/solution.cpp.o.d"
+  "/root/repo/tp3/source/solution_sink.cpp" "CMakeFiles/pandemic_test.dir/source/solution_sink.cpp.o" "gcc" "CMakeFiles/pandemic_test.dir/source/solution_sink.cpp.o.d"
+  "/root/repo/tp3/source/statistics.cpp" "CMakeFiles/pandemic_test.dir/source/statistics.cpp.o" "gcc" "CMakeFiles/pandemic_test.dir/source/statistics.cpp.o.d"
+  "/root/repo/tp3/source/thread_pinning.cpp" "CMakeFiles/pandemic_test.dir/source/thread_pinning.cpp.o" "gcc" "CMakeFiles/pandemic_test.dir/source/thread_pinning.cpp.o.d"
+  "/root/repo/tp3/source/trace.cpp" "CMakeFiles/pandemic_test.dir/source/trace.cpp.o" "gcc" "CMakeFiles/pandemic_test.dir/source/trace.cpp.o.d"
+  "/root/repo/tp3/tests/algorithm_anneal_test.cpp" "CMakeFiles/pandemic_test.dir/tests/algorithm_anneal_test.cpp.o" "gcc" "CMakeFiles/pandemic_test.dir/tests/algorithm_anneal_test.cpp.o.d"
+  "/root/repo/tp3/tests/algorithm_basic.cpp" "CMakeFiles/pandemic_test.dir/tests/algorithm_basic.cpp.o" "gcc" "CMakeFiles/pandemic_test.dir/tests/algorithm_basic.cpp.o.d"
+  "/root/repo/tp3/tests/algorithm_components_test.cpp" "CMakeFiles/pandemic_test.dir/tests/algorithm_components_test.cpp.o" "gcc" "CMakeFiles/pandemic_test.dir/tests/algorithm_components_test.cpp.o.d"
+  "/root/repo/tp3/tests/algorithm_greedy_test.cpp" "CMakeFiles/pandemic_test.dir/tests/algorithm_greedy_test.cpp.o" "gcc" "CMakeFiles/pandemic_test.dir/tests/algorithm_greedy_test.cpp.o.d"
+  "/root/repo/tp3/tests/batch_test.cpp" "CMakeFiles/pandemic_test.dir/tests/batch_test.cpp.o" "gcc" "CMakeFiles/pandemic_test.dir/tests/batch_test.cpp.o.d"
+  "/root/repo/tp3/tests/benchmark_test.cpp" "CMakeFiles/pandemic_test.dir/tests/benchmark_test.cpp.o" "gcc" "CMakeFiles/pandemic_test.dir/tests/benchmark_test.cpp.o.d"
+  "/root/repo/tp3/tests/chromosome_test.cpp" "CMakeFiles/pandemic_test.dir/tests/chromosome_test.cpp.o" "gcc" "CMakeFiles/pandemic_test.dir/tests/chromosome_test.cpp.o.d"
+  "/root/repo/tp3/tests/contagion_test.cpp" "CMakeFiles/pandemic_test.dir/tests/contagion_test.cpp.o" "gcc" "CMakeFiles/pandemic_test.dir/tests/contagion_test.cpp.o.d"
+  "/root/repo/tp3/tests/criteria_test.cpp" "CMakeFiles/pandemic_test.dir/tests/criteria_test.cpp.o" "gcc" "CMakeFiles/pandemic_test.dir/tests/criteria_test.cpp.o.d"
+  "/root/repo/tp3/tests/differential_test.cpp" "CMakeFiles/pandemic_test.dir/tests/differential_test.cpp.o" "gcc" "CMakeFiles/pandemic_test.dir/tests/differential_test.cpp.o.d"
+  "/root/repo/tp3/tests/isolation_bound_test.cpp" "CMakeFiles/pandemic_test.dir/tests/isolation_bound_test.cpp.o" "gcc" "CMakeFiles/pandemic_test.dir/tests/isolation_bound_test.cpp.o.d"
+  "/root/repo/tp3/tests/memory_test.cpp" "CMakeFiles/pandemic_test.dir/tests/memory_test.cpp.o" "gcc" "CMakeFiles/pandemic_test.dir/tests/memory_test.cpp.o.d"
+  "/root/repo/tp3/tests/operator_rates_test.cpp" "CMakeFiles/pandemic_test.dir/tests/operator_rates_test.cpp.o" "gcc" "CMakeFiles/pandemic_test.dir/tests/operator_rates_test.cpp.o.d"
+  "/root/repo/tp3/tests/population_test.cpp" "CMakeFiles/pandemic_test.dir/tests/population_test.cpp.o" "gcc" "CMakeFiles/pandemic_test.dir/tests/population_test.cpp.o.d"
+  "/root/repo/tp3/tests/relation_set_test.cpp" "CMakeFiles/pandemic_test.dir/tests/relation_set_test.cpp.o" "gcc" "CMakeFiles/pandemic_test.dir/tests/relation_set_test.cpp.o.d"
+  "/root/repo/tp3/tests/server_test.cpp" "CMakeFiles/pandemic_test.dir/tests/server_test.cpp.o" "gcc" "CMakeFiles/pandemic_test.dir/tests/server_test.cpp.o.d"
+  "/root/repo/tp3/tests/settings_test.cpp" "CMakeFiles/pandemic_test.dir/tests/settings_test.cpp.o" "gcc" "CMakeFiles/pandemic_test.dir/tests/settings_test.cpp.o.d"
+  "/root/repo/tp3/tests/solution_sink_test.cpp" "CMakeFiles/pandemic_test.dir/tests/solution_sink_test.cpp.o" "gcc" "CMakeFiles/pandemic_test.dir/tests/solution_sink_test.cpp.o.d"
+  "/root/repo/tp3/tests/solution_test.cpp" "CMakeFiles/pandemic_test.dir/tests/solution_test.cpp.o" "gcc" "CMakeFiles/pandemic_test.dir/tests/solution_test.cpp.o.d"
+  "/root/repo/tp3/tests/thread_pinning_test.cpp" "CMakeFiles/pandemic_test.dir/tests/thread_pinning_test.cpp.o" "gcc" "CMakeFiles/pandemic_test.dir/tests/thread_pinning_test.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
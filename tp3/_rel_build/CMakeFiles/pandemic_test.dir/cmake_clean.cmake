@@ -0,0 +1,103 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/pandemic_test.dir/source/algorithm.cpp.o"
+  "CMakeFiles/pandemic_test.dir/source/algorithm.cpp.o.d"
+  "CMakeFiles/pandemic_test.dir/source/algorithm_anneal.cpp.o"
+  "CMakeFiles/pandemic_test.dir/source/algorithm_anneal.cpp.o.d"
+  "CMakeFiles/pandemic_test.dir/source/algorithm_basic.cpp.o"
+  "CMakeFiles/pandemic_test.dir/source/algorithm_basic.cpp.o.d"
+  "CMakeFiles/pandemic_test.dir/source/algorithm_components.cpp.o"
+  "CMakeFiles/pandemic_test.dir/source/algorithm_components.cpp.o.d"
+  "CMakeFiles/pandemic_test.dir/source/algorithm_greedy.cpp.o"
+  "CMakeFiles/pandemic_test.dir/source/algorithm_greedy.cpp.o.d"
+  "CMakeFiles/pandemic_test.dir/source/batch.cpp.o"
+  "CMakeFiles/pandemic_test.dir/source/batch.cpp.o.d"
+  "CMakeFiles/pandemic_test.dir/source/benchmark.cpp.o"
+  "CMakeFiles/pandemic_test.dir/source/benchmark.cpp.o.d"
+  "CMakeFiles/pandemic_test.dir/source/chromosome.cpp.o"
+  "CMakeFiles/pandemic_test.dir/source/chromosome.cpp.o.d"
+  "CMakeFiles/pandemic_test.dir/source/chromosome_parallel.cpp.o"
+  "CMakeFiles/pandemic_test.dir/source/chromosome_parallel.cpp.o.d"
+  "CMakeFiles/pandemic_test.dir/source/contagion.cpp.o"
+  "CMakeFiles/pandemic_test.dir/source/contagion.cpp.o.d"
+  "CMakeFiles/pandemic_test.dir/source/criteria.cpp.o"
+  "CMakeFiles/pandemic_test.dir/source/criteria.cpp.o.d"
+  "CMakeFiles/pandemic_test.dir/source/differential.cpp.o"
+  "CMakeFiles/pandemic_test.dir/source/differential.cpp.o.d"
+  "CMakeFiles/pandemic_test.dir/source/engine.cpp.o"
+  "CMakeFiles/pandemic_test.dir/source/engine.cpp.o.d"
+  "CMakeFiles/pandemic_test.dir/source/isolation_bound.cpp.o"
+  "CMakeFiles/pandemic_test.dir/source/isolation_bound.cpp.o.d"
+  "CMakeFiles/pandemic_test.dir/source/main_test.cpp.o"
+  "CMakeFiles/pandemic_test.dir/source/main_test.cpp.o.d"
+  "CMakeFiles/pandemic_test.dir/source/memory.cpp.o"
+  "CMakeFiles/pandemic_test.dir/source/memory.cpp.o.d"
+  "CMakeFiles/pandemic_test.dir/source/operator_rates.cpp.o"
+  "CMakeFiles/pandemic_test.dir/source/operator_rates.cpp.o.d"
+  "CMakeFiles/pandemic_test.dir/source/population.cpp.o"
+  "CMakeFiles/pandemic_test.dir/source/population.cpp.o.d"
+  "CMakeFiles/pandemic_test.dir/source/printer.cpp.o"
+  "CMakeFiles/pandemic_test.dir/source/printer.cpp.o.d"
+  "CMakeFiles/pandemic_test.dir/source/relation_set.cpp.o"
+  "CMakeFiles/pandemic_test.dir/source/relation_set.cpp.o.d"
+  "CMakeFiles/pandemic_test.dir/source/server.cpp.o"
+  "CMakeFiles/pandemic_test.dir/source/server.cpp.o.d"
+  "CMakeFiles/pandemic_test.dir/source/settings.cpp.o"
+  "CMakeFiles/pandemic_test.dir/source/settings.cpp.o.d"
+  "CMakeFiles/pandemic_test.dir/source/solution.cpp.o"
+  "CMakeFiles/pandemic_test.dir/source/solution.cpp.o.d"
+  "CMakeFiles/pandemic_test.dir/source/solution_sink.cpp.o"
+  "CMakeFiles/pandemic_test.dir/source/solution_sink.cpp.o.d"
+  "CMakeFiles/pandemic_test.dir/source/statistics.cpp.o"
+  "CMakeFiles/pandemic_test.dir/source/statistics.cpp.o.d"
+  "CMakeFiles/pandemic_test.dir/source/thread_pinning.cpp.o"
+  "CMakeFiles/pandemic_test.dir/source/thread_pinning.cpp.o.d"
+  "CMakeFiles/pandemic_test.dir/source/trace.cpp.o"
+  "CMakeFiles/pandemic_test.dir/source/trace.cpp.o.d"
+  "CMakeFiles/pandemic_test.dir/tests/algorithm_anneal_test.cpp.o"
+  "CMakeFiles/pandemic_test.dir/tests/algorithm_anneal_test.cpp.o.d"
+  "CMakeFiles/pandemic_test.dir/tests/algorithm_basic.cpp.o"
+  "CMakeFiles/pandemic_test.dir/tests/algorithm_basic.cpp.o.d"
+  "CMakeFiles/pandemic_test.dir/tests/algorithm_components_test.cpp.o"
+  "CMakeFiles/pandemic_test.dir/tests/algorithm_components_test.cpp.o.d"
+  "CMakeFiles/pandemic_test.dir/tests/algorithm_greedy_test.cpp.o"
+  "CMakeFiles/pandemic_test.dir/tests/algorithm_greedy_test.cpp.o.d"
+  "CMakeFiles/pandemic_test.dir/tests/batch_test.cpp.o"
+  "CMakeFiles/pandemic_test.dir/tests/batch_test.cpp.o.d"
+  "CMakeFiles/pandemic_test.dir/tests/benchmark_test.cpp.o"
+  "CMakeFiles/pandemic_test.dir/tests/benchmark_test.cpp.o.d"
+  "CMakeFiles/pandemic_test.dir/tests/chromosome_test.cpp.o"
+  "CMakeFiles/pandemic_test.dir/tests/chromosome_test.cpp.o.d"
+  "CMakeFiles/pandemic_test.dir/tests/contagion_test.cpp.o"
+  "CMakeFiles/pandemic_test.dir/tests/contagion_test.cpp.o.d"
+  "CMakeFiles/pandemic_test.dir/tests/criteria_test.cpp.o"
+  "CMakeFiles/pandemic_test.dir/tests/criteria_test.cpp.o.d"
+  "CMakeFiles/pandemic_test.dir/tests/differential_test.cpp.o"
+  "CMakeFiles/pandemic_test.dir/tests/differential_test.cpp.o.d"
+  "CMakeFiles/pandemic_test.dir/tests/isolation_bound_test.cpp.o"
+  "CMakeFiles/pandemic_test.dir/tests/isolation_bound_test.cpp.o.d"
+  "CMakeFiles/pandemic_test.dir/tests/memory_test.cpp.o"
+  "CMakeFiles/pandemic_test.dir/tests/memory_test.cpp.o.d"
+  "CMakeFiles/pandemic_test.dir/tests/operator_rates_test.cpp.o"
+  "CMakeFiles/pandemic_test.dir/tests/operator_rates_test.cpp.o.d"
+  "CMakeFiles/pandemic_test.dir/tests/population_test.cpp.o"
+  "CMakeFiles/pandemic_test.dir/tests/population_test.cpp.o.d"
+  "CMakeFiles/pandemic_test.dir/tests/relation_set_test.cpp.o"
+  "CMakeFiles/pandemic_test.dir/tests/relation_set_test.cpp.o.d"
+  "CMakeFiles/pandemic_test.dir/tests/server_test.cpp.o"
+  "CMakeFiles/pandemic_test.dir/tests/server_test.cpp.o.d"
+  "CMakeFiles/pandemic_test.dir/tests/settings_test.cpp.o"
+  "CMakeFiles/pandemic_test.dir/tests/settings_test.cpp.o.d"
+  "CMakeFiles/pandemic_test.dir/tests/solution_sink_test.cpp.o"
+  "CMakeFiles/pandemic_test.dir/tests/solution_sink_test.cpp.o.d"
+  "CMakeFiles/pandemic_test.dir/tests/solution_test.cpp.o"
+  "CMakeFiles/pandemic_test.dir/tests/solution_test.cpp.o.d"
+  "CMakeFiles/pandemic_test.dir/tests/thread_pinning_test.cpp.o"
+  "CMakeFiles/pandemic_test.dir/tests/thread_pinning_test.cpp.o.d"
+  "pandemic_test"
+  "pandemic_test.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/pandemic_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
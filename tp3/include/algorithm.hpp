@@ -2,47 +2,72 @@
 #define INCLUDE_ALGORITHM_HPP
 
 #include <chromosome.hpp>
+#include <contagion.hpp>
+#include <criteria.hpp>
+#include <engine.hpp>
+#include <operator_rates.hpp>
 #include <population.hpp>
+#include <printer.hpp>
+#include <relation_set.hpp>
 #include <settings.hpp>
+#include <statistics.hpp>
 
 #include <atomic>
 #include <chrono>
+#include <optional>
 #include <set>
+#include <vector>
 
 namespace tp::type {
 
 using solution = std::pair<unsigned int, chromosome*>;
 using chromosome_costs = std::multimap<unsigned int, tp::chromosome*>;
-using chromosomes = std::set<tp::chromosome*>;
 
 } /* namespace tp::type */
 
 namespace tp {
 
-class algorithm {
+class algorithm : public engine {
   public:
-    algorithm(bool print_solutions, bool print_timestamp, settings& settings, const population& pop);
+    algorithm(printer& printer, settings& settings, criteria& criteria,
+              statistics* statistics, const population& pop);
     ~algorithm();
-    void run();
-    void stop();
+    void inject(const type::relations& isolations);
+    void run() override;
+    void stop() override;
+    const type::chromosomes& chromosomes() const;
   private:
-    void print_solution(const type::solution& solution) const;
-    type::solution evolve();
+    static constexpr unsigned int k_injected_variants = 2;
+
+    type::solution evolve(type::generation_stats& stats);
     void remove_worst_chromosomes(type::chromosomes& removed, const type::chromosome_costs& costs);
     void replace_invalid_chromosomes(type::chromosomes& removed, const type::chromosomes& invalids);
 
+    void seed_chromosomes();
     void cross_random_chromosomes();
     void mutate_random_chromosomes();
     void mutate_increase_chromosome(chromosome* chromosome);
+    void adopt(chromosome* chromosome);
+    void update_operator_rates(const type::chromosomes& invalids);
 
-    const bool print_solutions_;
-    const bool print_timestamp_;
+    printer& printer_;
     std::atomic_bool running_;
     std::chrono::time_point<std::chrono::high_resolution_clock> start_time_;
 
     settings& settings_;
+    criteria& criteria_;
+    statistics* statistics_;
     const population& population_;
+    const contagion contagion_;
     type::chromosomes chromosomes_;
+    unsigned long next_serial_ = 0;
+    type::chromosomes crossed_;
+    type::chromosomes mutated_;
+    std::optional<operator_rates> operator_rates_;
+    std::vector<type::relations> injected_;
+
+    std::optional<unsigned int> best_cost_;
+    relation_set best_isolations_;
 };
 
 } /* namespace tp */
@@ -0,0 +1,94 @@
+#ifndef INCLUDE_ALGORITHM_ANNEAL_HPP
+#define INCLUDE_ALGORITHM_ANNEAL_HPP
+
+#include <chromosome.hpp>
+#include <contagion.hpp>
+#include <criteria.hpp>
+#include <engine.hpp>
+#include <population.hpp>
+#include <printer.hpp>
+#include <relation_set.hpp>
+#include <settings.hpp>
+
+#include <atomic>
+#include <optional>
+#include <vector>
+
+namespace tp {
+
+/*
+ * Single-solution local search over the chromosome moves. Each chain keeps
+ * the bitmap of its isolations and the people infected by them so most moves
+ * are evaluated without simulating the propagation again. Invalid solutions
+ * are allowed, at a penalty for each infected person above the limit.
+ */
+class algorithm_anneal : public engine {
+  public:
+    enum class mode { anneal, tabu };
+
+    algorithm_anneal(printer& printer, settings& settings, criteria& criteria,
+                     const population& pop, mode mode, unsigned int chains);
+    void run() override;
+    void stop() override;
+  private:
+    static constexpr unsigned int k_anneal_steps = 256;
+    static constexpr unsigned int k_tabu_steps = 16;
+    static constexpr unsigned int k_tabu_candidates = 64;
+    static constexpr unsigned int k_tabu_tenure = 8;
+    static constexpr unsigned int k_tabu_restart = 200;
+    static constexpr float k_penalty = 1;
+    static constexpr float k_initial_temperature = 2;
+    static constexpr float k_final_temperature = 0.05;
+    static constexpr float k_cooling = 0.999;
+
+    struct chain {
+      chromosome current;
+      std::vector<bool> isolated;
+      std::vector<unsigned int> rounds;
+      unsigned int infected;
+      float temperature;
+      unsigned long iteration;
+      unsigned long improved_at;
+      std::vector<unsigned long> tabu_until;
+      std::optional<unsigned int> best_cost;
+      relation_set best_isolations;
+    };
+
+    struct candidate {
+      type::move move;
+      float energy;
+      unsigned int infected;
+      std::vector<unsigned int> rounds;
+    };
+
+    chain make_chain(const type::relations& isolations) const;
+    void anneal(chain& chain) const;
+    void tabu(chain& chain) const;
+
+    type::move random_move(chain& chain) const;
+    bool evaluate(chain& chain, const type::move& move, candidate& result) const;
+    void accept(chain& chain, candidate& result) const;
+    void reject(chain& chain, const type::move& move) const;
+    void update_best(chain& chain) const;
+    void restart(chain& chain) const;
+    void toggle(std::vector<bool>& isolated, const type::move& move, bool apply) const;
+    float energy(unsigned int isolations, unsigned int infected) const;
+
+    printer& printer_;
+    settings& settings_;
+    criteria& criteria_;
+    const population& population_;
+    const contagion contagion_;
+    const mode mode_;
+    const unsigned int chain_count_;
+    const unsigned int limit_;
+    std::vector<chain> chains_;
+    std::atomic_bool running_;
+
+    std::optional<unsigned int> best_cost_;
+    relation_set best_isolations_;
+};
+
+} /* namespace tp */
+
+#endif /* INCLUDE_ALGORITHM_ANNEAL_HPP */
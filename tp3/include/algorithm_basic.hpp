@@ -4,6 +4,8 @@
 #include <population.hpp>
 #include <settings.hpp>
 
+#include <vector>
+
 namespace tp {
 
 class algorithm_basic {
@@ -11,9 +13,15 @@ class algorithm_basic {
     algorithm_basic(settings& settings, const population& pop);
     type::relations isolate_infected() const;
     type::relations isolate_50_percent() const;
+    type::relations isolate_50_percent(type::person root) const;
   private:
     const settings& settings_;
     const population& population_;
+
+    unsigned int span_;
+    std::vector<unsigned int> offsets_;
+    std::vector<type::person> neighbors_;
+    std::vector<bool> infected_;
 };
 
 } /* namespace tp */
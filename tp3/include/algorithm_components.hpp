@@ -0,0 +1,74 @@
+#ifndef INCLUDE_ALGORITHM_COMPONENTS_HPP
+#define INCLUDE_ALGORITHM_COMPONENTS_HPP
+
+#include <criteria.hpp>
+#include <engine.hpp>
+#include <population.hpp>
+#include <printer.hpp>
+#include <settings.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <limits>
+#include <optional>
+#include <vector>
+
+namespace tp::type {
+
+using component = std::vector<person>;
+
+struct curve_point {
+  unsigned int infected;
+  relations isolations;
+};
+
+} /* namespace tp::type */
+
+namespace tp {
+
+/*
+ * Solves each connected component apart. The greedy engine gives, for a few
+ * infection limits, the isolations a component needs to stay under the limit.
+ * A knapsack over these trade-off curves then picks one point per component
+ * so the whole population stays under half infected with the fewest
+ * isolations. Once the criteria are done, the curves keep the points found
+ * so far. The knapsack runs on one thread and keeps only the costs of one
+ * total range at a time, finding the chosen points by splitting the
+ * components in halves.
+ */
+class algorithm_components : public engine {
+  public:
+    algorithm_components(printer& printer, settings& settings, const population& pop, criteria* criteria = nullptr);
+    void run() override;
+    void stop() override;
+
+    const std::vector<type::component>& components() const;
+    std::vector<type::curve_point> curve(const type::component& component) const;
+    std::optional<type::relations> solve();
+  private:
+    static constexpr unsigned int k_curve_points = 16;
+    static constexpr unsigned int k_none = std::numeric_limits<unsigned int>::max();
+
+    struct choice {
+      const std::vector<type::curve_point>* curve;
+      unsigned int least;
+      unsigned int range;
+    };
+
+    static std::vector<unsigned int> knapsack(const std::vector<choice>& choosing, std::size_t begin,
+                                              std::size_t end, unsigned int limit);
+    static void pick(const std::vector<choice>& choosing, std::size_t begin, std::size_t end, unsigned int total,
+                     std::vector<std::size_t>& picked);
+
+    printer& printer_;
+    settings& settings_;
+    criteria* criteria_;
+    const population& population_;
+    std::vector<type::component> components_;
+    std::vector<unsigned int> local_;
+    std::atomic_bool running_;
+};
+
+} /* namespace tp */
+
+#endif /* INCLUDE_ALGORITHM_COMPONENTS_HPP */
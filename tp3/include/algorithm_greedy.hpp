@@ -0,0 +1,40 @@
+#ifndef INCLUDE_ALGORITHM_GREEDY_HPP
+#define INCLUDE_ALGORITHM_GREEDY_HPP
+
+#include <contagion.hpp>
+#include <criteria.hpp>
+#include <engine.hpp>
+#include <population.hpp>
+#include <printer.hpp>
+#include <settings.hpp>
+
+#include <atomic>
+#include <vector>
+
+namespace tp {
+
+class algorithm_greedy : public engine {
+  public:
+    algorithm_greedy(printer& printer, settings& settings, const population& pop, criteria* criteria = nullptr,
+                     const std::atomic_bool* outer_running = nullptr);
+    void run() override;
+    void stop() override;
+
+    type::relations solve();
+    type::relations solve(unsigned int limit);
+  private:
+    std::vector<type::relation_id> isolate_pressure(std::vector<bool>& isolated, unsigned int limit) const;
+    void prune(std::vector<bool>& isolated, const std::vector<type::relation_id>& order, unsigned int limit) const;
+    bool stopped() const;
+
+    printer& printer_;
+    settings& settings_;
+    criteria* criteria_;
+    const std::atomic_bool* outer_running_;
+    const contagion contagion_;
+    std::atomic_bool running_;
+};
+
+} /* namespace tp */
+
+#endif /* INCLUDE_ALGORITHM_GREEDY_HPP */
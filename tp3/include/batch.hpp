@@ -0,0 +1,41 @@
+#ifndef INCLUDE_BATCH_HPP
+#define INCLUDE_BATCH_HPP
+
+#include <filesystem>
+#include <string>
+#include <variant>
+#include <vector>
+
+namespace tp::type {
+
+struct job {
+  std::string dataset;
+  unsigned int virality = 0;
+  unsigned int seed = 0;
+  float seconds = 0;
+};
+
+} /* namespace tp::type */
+
+namespace tp {
+
+/*
+ * List of jobs read from a file with one "dataset virality seed seconds" job
+ * per line. Empty lines and lines starting with '#' are skipped.
+ */
+class batch {
+  public:
+    static std::variant<batch, std::string> from_file(const std::filesystem::path& path);
+
+    const std::vector<type::job>& jobs() const;
+    std::vector<std::string> datasets() const;
+    std::vector<std::vector<std::size_t>> chains() const;
+  private:
+    batch(std::vector<type::job>&& jobs);
+
+    std::vector<type::job> jobs_;
+};
+
+} /* namespace tp */
+
+#endif /* INCLUDE_BATCH_HPP */
@@ -0,0 +1,90 @@
+#ifndef INCLUDE_BENCHMARK_HPP
+#define INCLUDE_BENCHMARK_HPP
+
+#include <memory.hpp>
+#include <population.hpp>
+
+#include <chrono>
+#include <cstdint>
+#include <filesystem>
+#include <optional>
+#include <random>
+#include <string>
+#include <variant>
+#include <vector>
+
+namespace tp::type {
+
+struct bench_result {
+  std::string benchmark;
+  std::string scale;
+  std::uint64_t ops = 0;
+  double ns_per_op = 0;
+  double evaluations_per_second = 0;
+  double allocations_per_op = 0;
+};
+
+struct bench_scale {
+  std::string name;
+  unsigned int persons = 0;
+  unsigned int relations = 0;
+  unsigned int infected_percent = 0;
+};
+
+} /* namespace tp::type */
+
+namespace tp {
+
+/*
+ * Timing of the hot paths of pandemic on generated populations. Results are
+ * written as one JSON object per line, and a previous output can be read back
+ * as a baseline to flag the benchmarks that got slower.
+ */
+class benchmark {
+  public:
+    static const std::vector<type::bench_scale>& scales();
+    static population generate(const type::bench_scale& scale, std::mt19937& generator);
+    static std::optional<std::string> write(const population& pop, const std::filesystem::path& path);
+
+    // repeats op, which returns the number of evaluations it made, until
+    // min_time has elapsed
+    template <typename Op>
+    static type::bench_result measure(const std::string& name, const std::string& scale,
+                                      std::chrono::duration<double> min_time, Op&& op) {
+      using clock = std::chrono::steady_clock;
+
+      std::uint64_t ops = 0;
+      std::uint64_t evaluations = 0;
+      auto allocations = memory::allocations();
+      auto start = clock::now();
+      auto elapsed = clock::duration::zero();
+
+      do {
+        evaluations += op();
+        ops++;
+        elapsed = clock::now() - start;
+      } while (elapsed < min_time);
+
+      auto allocated = memory::allocations() - allocations;
+      double seconds = std::chrono::duration<double>(elapsed).count();
+
+      return {
+        name,
+        scale,
+        ops,
+        seconds * 1e9 / ops,
+        seconds > 0 ? evaluations / seconds : 0,
+        ((double) allocated.count) / ops,
+      };
+    }
+
+    static std::string to_json(const type::bench_result& result);
+    static std::optional<type::bench_result> from_json(const std::string& line);
+    static std::variant<std::vector<type::bench_result>, std::string> load_baseline(const std::filesystem::path& path);
+    static std::optional<double> slowdown(const type::bench_result& result,
+                                          const std::vector<type::bench_result>& baseline);
+};
+
+} /* namespace tp */
+
+#endif /* INCLUDE_BENCHMARK_HPP */
@@ -1,34 +1,84 @@
 #ifndef INCLUDE_CHROMOSOME_HPP
 #define INCLUDE_CHROMOSOME_HPP
 
+#include <contagion.hpp>
 #include <settings.hpp>
 #include <population.hpp>
+#include <relation_set.hpp>
 
 #include <optional>
 #include <set>
 #include <map>
 
+namespace tp::type {
+
+struct move {
+  std::optional<relation> added;
+  std::optional<relation> removed;
+};
+
+// how an evaluation reached its verdict, from the cheapest to the most
+// expensive: a verdict kept from an earlier generation, one inferred from the
+// parent, a simulation cut short past the threshold, or a full simulation
+enum class screening { cached, inferred, aborted, simulated };
+
+struct evaluation {
+  std::optional<unsigned int> cost;
+  screening stage;
+};
+
+} /* namespace tp::type */
+
 namespace tp {
 
 class chromosome {
   public:
     chromosome(settings& settings, const population& pop);
     chromosome(settings& settings, const population& pop, const type::relations& isolations);
+    chromosome(settings& settings, const population& pop, const relation_set& isolations);
 
-    const type::relations& isolations() const;
+    const relation_set& isolations() const;
     std::pair<chromosome*, chromosome*> cross(const chromosome* other) const;
     chromosome* mutate(unsigned int add, unsigned int remove, unsigned int update) const;
     std::optional<unsigned int> cost();
+    std::optional<unsigned int> cost(const contagion& contagion, bool parallel = false);
+    type::evaluation evaluate(const contagion& contagion, bool parallel = false);
+
+    type::move add_isolation();
+    type::move remove_isolation();
+    type::move update_isolation();
+    void apply(const type::move& move);
+    void undo(const type::move& move);
+
+    unsigned long serial() const;
+    void set_serial(unsigned long serial);
   private:
-    void add_isolation();
-    void remove_isolation();
-    void update_isolation();
+    static constexpr unsigned int k_add_attempts = 16;
+
+    enum class validity { unknown, valid, invalid };
 
     settings& settings_;
     const population& population_;
-    type::relations isolations_;
+    relation_set isolations_;
+    validity validity_ = validity::unknown;
+    bool inferred_ = false;
+    unsigned long serial_ = 0;
 };
 
 } /* namespace tp */
 
+namespace tp::type {
+
+// chromosomes ordered by serial rather than by address, so that a seeded run
+// picks the same chromosomes whatever the allocator returns
+struct serial_order {
+  bool operator()(const chromosome* a, const chromosome* b) const {
+    return a->serial() < b->serial();
+  }
+};
+
+using chromosomes = std::set<chromosome*, serial_order>;
+
+} /* namespace tp::type */
+
 #endif /* INCLUDE_CHROMOSOME_HPP */
@@ -2,40 +2,71 @@
 #define INCLUDE_CHROMOSOME_PARALLEL_HPP
 
 #include <chromosome.hpp>
+#include <contagion.hpp>
 
+#include <array>
+#include <atomic>
 #include <map>
+#include <optional>
 #include <set>
+#include <tuple>
 #include <vector>
 
 namespace tp::parallel {
 
 class chromosome_costs {
   public:
+    chromosome_costs(const contagion& contagion);
     void operator()(std::vector<chromosome*>& chromosomes, unsigned int max);
     const std::multimap<unsigned int, chromosome*>& costs() const;
-    const std::set<chromosome*> invalids() const;
+    const type::chromosomes& invalids() const;
+    unsigned int screened(type::screening screening) const;
   private:
+    static constexpr unsigned int k_parallel_relations = 1 << 20;
+    static constexpr std::size_t k_screenings = 4;
+
+    std::optional<unsigned int> evaluate(chromosome* evaluated, bool parallel);
+
+    const contagion& contagion_;
     std::multimap<unsigned int, chromosome*> costs_;
-    std::set<chromosome*> invalids_;
+    type::chromosomes invalids_;
+    std::array<std::atomic<unsigned int>, k_screenings> screened_{};
 };
 
 using cross_settings = std::pair<chromosome*, chromosome*>;
 
 class chromosome_cross {
   public:
+    chromosome_cross(settings& settings);
     void operator()(std::vector<cross_settings>& settings);
     const std::vector<chromosome*>& created() const;
   private:
-    std::vector<chromosome*> created_;   
+    settings& settings_;
+    std::vector<chromosome*> created_;
 };
 
 using mutation_settings = std::tuple<chromosome*, unsigned int, unsigned int, unsigned int>;
 
 class chromosome_mutate {
   public:
+    chromosome_mutate(settings& settings);
     void operator()(std::vector<mutation_settings>& settings);
     const std::vector<chromosome*>& created() const;
   private:
+    settings& settings_;
+    std::vector<chromosome*> created_;
+};
+
+using seed_settings = std::tuple<std::optional<type::person>, unsigned int, unsigned int>;
+
+class chromosome_seed {
+  public:
+    chromosome_seed(settings& settings, const population& pop);
+    void operator()(std::vector<seed_settings>& settings);
+    const std::vector<chromosome*>& created() const;
+  private:
+    settings& settings_;
+    const population& population_;
     std::vector<chromosome*> created_;
 };
 
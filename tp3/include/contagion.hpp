@@ -0,0 +1,92 @@
+#ifndef INCLUDE_CONTAGION_HPP
+#define INCLUDE_CONTAGION_HPP
+
+#include <population.hpp>
+#include <relation_set.hpp>
+
+#include <cstdint>
+#include <limits>
+#include <optional>
+#include <utility>
+#include <vector>
+
+namespace tp::type {
+
+using relation_id = unsigned int;
+using adjacent = std::pair<person, relation_id>;
+
+} /* namespace tp::type */
+
+namespace tp {
+
+/*
+ * Flat snapshot of a population used to simulate the propagation quickly. The
+ * relations are numbered in their sorted order so isolations can be given as
+ * a bitmap over relation ids. Results match population::run.
+ *
+ * Dense populations are also kept as a bit matrix, one row per person, so
+ * the infected neighbours of a person are counted a word at a time instead of
+ * following each relation.
+ */
+class contagion {
+  public:
+    enum class backend { automatic, sparse, dense };
+
+    contagion(const population& pop, backend backend = backend::automatic);
+
+    unsigned int size() const;
+    unsigned int relation_count() const;
+    std::size_t footprint() const;
+    static std::size_t footprint(const population& pop, backend backend = backend::automatic);
+    std::optional<type::relation_id> relation_id(const type::relation& relation) const;
+    const type::relation& relation(type::relation_id id) const;
+    const type::adjacent* adjacents_begin(type::person i) const;
+    const type::adjacent* adjacents_end(type::person i) const;
+    bool infected(type::person i) const;
+    bool dense() const;
+
+    std::vector<bool> isolated(const type::relations& isolations) const;
+    std::vector<bool> isolated(const relation_set& isolations) const;
+
+    unsigned int run(unsigned int virality, const type::relations& isolations) const;
+    unsigned int run(unsigned int virality, const std::vector<bool>& isolated,
+                     std::vector<unsigned int>* rounds = nullptr) const;
+    unsigned int run_parallel(unsigned int virality, const std::vector<bool>& isolated,
+                              std::vector<unsigned int>* rounds = nullptr) const;
+    bool exceeds(unsigned int virality, const std::vector<bool>& isolated,
+                 unsigned int limit, bool parallel = false) const;
+    float percent(unsigned int infected) const;
+  private:
+    static constexpr unsigned int k_parallel_frontier = 1024;
+    static constexpr unsigned int k_dense_max_size = 1 << 16;
+    static constexpr float k_dense_density = 0.3;
+    static constexpr unsigned int k_unlimited = std::numeric_limits<unsigned int>::max();
+
+    static unsigned int span(const population& pop);
+    static bool dense(unsigned int size, std::size_t relation_count, backend backend);
+
+    template <typename Relations>
+    std::vector<bool> isolated_sorted(const Relations& isolations) const;
+
+    unsigned int run_sparse(unsigned int virality, const std::vector<bool>& isolated,
+                            std::vector<unsigned int>* rounds, unsigned int limit) const;
+    unsigned int run_sparse_parallel(unsigned int virality, const std::vector<bool>& isolated,
+                                     std::vector<unsigned int>* rounds, unsigned int limit) const;
+    unsigned int run_dense(unsigned int virality, const std::vector<bool>& isolated,
+                           std::vector<unsigned int>* rounds, unsigned int limit) const;
+
+    unsigned int size_;
+    unsigned int span_;
+    unsigned int initial_count_;
+    std::vector<type::relation> relations_;
+    std::vector<unsigned int> offsets_;
+    std::vector<type::adjacent> adjacents_;
+    std::vector<type::person> initial_;
+    std::vector<bool> infected_;
+    unsigned int words_;
+    std::vector<std::uint64_t> matrix_;
+};
+
+} /* namespace tp */
+
+#endif /* INCLUDE_CONTAGION_HPP */
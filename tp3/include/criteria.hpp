@@ -0,0 +1,40 @@
+#ifndef INCLUDE_CRITERIA_HPP
+#define INCLUDE_CRITERIA_HPP
+
+#include <chrono>
+#include <optional>
+
+namespace tp {
+
+class criteria {
+  public:
+    criteria();
+
+    void set_time_limit(std::chrono::milliseconds limit);
+    void set_max_generations(unsigned int generations);
+    void set_target_cost(unsigned int cost);
+    void set_stagnation(unsigned int generations);
+    void set_lower_bound(unsigned int bound);
+
+    void start();
+    void next_generation(bool improved);
+    bool done(std::optional<unsigned int> best_cost) const;
+
+    std::optional<unsigned int> lower_bound() const;
+    unsigned int generation() const;
+    std::chrono::milliseconds elapsed() const;
+  private:
+    std::optional<std::chrono::milliseconds> time_limit_;
+    std::optional<unsigned int> max_generations_;
+    std::optional<unsigned int> target_cost_;
+    std::optional<unsigned int> stagnation_;
+    std::optional<unsigned int> lower_bound_;
+
+    unsigned int generation_;
+    unsigned int stagnant_generations_;
+    std::chrono::time_point<std::chrono::steady_clock> start_time_;
+};
+
+} /* namespace tp */
+
+#endif /* INCLUDE_CRITERIA_HPP */
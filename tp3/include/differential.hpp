@@ -0,0 +1,50 @@
+#ifndef INCLUDE_DIFFERENTIAL_HPP
+#define INCLUDE_DIFFERENTIAL_HPP
+
+#include <population.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <optional>
+#include <ostream>
+#include <random>
+#include <string>
+
+namespace tp::type {
+
+struct simulation_case {
+  unsigned int size = 0;
+  unsigned int virality = 0;
+  persons infected;
+  type::relations relations;
+  type::relations isolations;
+};
+
+} /* namespace tp::type */
+
+namespace tp {
+
+/*
+ * Differential testing of the contagion backends against population::run, the
+ * reference semantics. Cases come from a random generator or from raw fuzzer
+ * bytes, and a failing case is shrunk to a minimal one before being reported.
+ */
+class differential {
+  public:
+    using predicate = std::function<bool(const type::simulation_case&)>;
+
+    static type::simulation_case random_case(std::mt19937& generator, unsigned int max_size);
+    static type::simulation_case from_bytes(const std::uint8_t* data, std::size_t size);
+
+    static population make_population(const type::simulation_case& simulation);
+    static std::optional<std::string> check(const type::simulation_case& simulation);
+    static type::simulation_case shrink(const type::simulation_case& simulation, const predicate& fails);
+    static void print(std::ostream& output, const type::simulation_case& simulation);
+  private:
+    static constexpr unsigned int k_max_virality = 5;
+};
+
+} /* namespace tp */
+
+#endif /* INCLUDE_DIFFERENTIAL_HPP */
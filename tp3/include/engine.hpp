@@ -0,0 +1,35 @@
+#ifndef INCLUDE_ENGINE_HPP
+#define INCLUDE_ENGINE_HPP
+
+#include <criteria.hpp>
+#include <population.hpp>
+#include <printer.hpp>
+#include <settings.hpp>
+#include <statistics.hpp>
+
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace tp {
+
+/*
+ * An engine is run once. It starts with its stop flag cleared, so a stop()
+ * that comes before or during run() always makes it return.
+ */
+class engine {
+  public:
+    virtual ~engine();
+    virtual void run() = 0;
+    virtual void stop() = 0;
+
+    static bool known(const std::string& name);
+    static std::unique_ptr<engine> create(const std::string& name, printer& printer, settings& settings,
+                                          criteria& criteria, statistics* statistics, const population& pop,
+                                          unsigned int chains, bool greedy_seed,
+                                          const std::vector<type::relations>& injected = {});
+};
+
+} /* namespace tp */
+
+#endif /* INCLUDE_ENGINE_HPP */
@@ -0,0 +1,30 @@
+#ifndef INCLUDE_ISOLATION_BOUND_HPP
+#define INCLUDE_ISOLATION_BOUND_HPP
+
+#include <population.hpp>
+#include <settings.hpp>
+
+#include <optional>
+
+namespace tp {
+
+/*
+ * Counting bound on the number of isolations of any valid solution. A healthy
+ * person with d >= virality infected neighbors is infected at the first round
+ * unless d - virality + 1 of these relations are isolated, and these relations
+ * are not shared with any other healthy person. At most half the population
+ * may end up infected, so the cheapest persons beyond that allowance must be
+ * protected.
+ */
+class isolation_bound {
+  public:
+    isolation_bound(const settings& settings, const population& pop);
+    std::optional<unsigned int> compute() const;
+  private:
+    const settings& settings_;
+    const population& population_;
+};
+
+} /* namespace tp */
+
+#endif /* INCLUDE_ISOLATION_BOUND_HPP */
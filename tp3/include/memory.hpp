@@ -0,0 +1,57 @@
+#ifndef INCLUDE_MEMORY_HPP
+#define INCLUDE_MEMORY_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace tp::type {
+
+struct allocations {
+  std::uint64_t count = 0;
+  std::uint64_t bytes = 0;
+  std::uint64_t frees = 0;
+
+  allocations operator-(const allocations& other) const {
+    return {count - other.count, bytes - other.bytes, frees - other.frees};
+  }
+};
+
+} /* namespace tp::type */
+
+namespace tp {
+
+/*
+ * Memory accounting of the process. The global operator new and delete are
+ * replaced to count every allocation made through them, and the footprint of
+ * a structure is estimated from the node and element sizes of its containers,
+ * allocator overhead excluded. Allocations made by TBB through its own
+ * allocators, such as scalable_malloc, bypass operator new and are not
+ * counted.
+ */
+class memory {
+  public:
+    static type::allocations allocations();
+    static std::size_t peak_rss();
+    static std::string format(std::size_t bytes);
+
+    // libstdc++ red-black tree nodes carry a color and three links
+    template <typename T>
+    static constexpr std::size_t tree_node() {
+      return 4 * sizeof(void*) + sizeof(T);
+    }
+
+    template <typename T>
+    static std::size_t vector(const std::vector<T>& values) {
+      return values.capacity() * sizeof(T);
+    }
+
+    static std::size_t vector(const std::vector<bool>& values) {
+      return values.capacity() / 8;
+    }
+};
+
+} /* namespace tp */
+
+#endif /* INCLUDE_MEMORY_HPP */
@@ -0,0 +1,30 @@
+#ifndef INCLUDE_OPERATOR_RATES_HPP
+#define INCLUDE_OPERATOR_RATES_HPP
+
+#include <settings.hpp>
+
+namespace tp {
+
+class operator_rates {
+  public:
+    operator_rates(const settings& settings);
+
+    unsigned int cross_count() const;
+    unsigned int mutation_count() const;
+
+    void update(unsigned int crossed, unsigned int cross_successes,
+                unsigned int mutated, unsigned int mutation_successes);
+  private:
+    static constexpr float k_smoothing = 0.3;
+    static constexpr float k_min_share = 0.1;
+
+    const unsigned int budget_;
+    float cross_rate_;
+    float mutation_rate_;
+    unsigned int cross_count_;
+    unsigned int mutation_count_;
+};
+
+} /* namespace tp */
+
+#endif /* INCLUDE_OPERATOR_RATES_HPP */
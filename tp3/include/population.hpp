@@ -1,10 +1,14 @@
 #ifndef INCLUDE_POPULATION_HPP
 #define INCLUDE_POPULATION_HPP
 
+#include <atomic>
+#include <cstddef>
 #include <filesystem>
 #include <map>
+#include <mutex>
 #include <set>
 #include <variant>
+#include <vector>
 
 namespace tp::type {
 
@@ -25,12 +29,14 @@ class population {
     population(unsigned int size);
     static std::variant<population, std::string> from_file(const std::filesystem::path& path);
     unsigned int size() const;
+    std::size_t footprint() const;
 
     void add_relation(const type::relation& relation);
     void add_infected(type::person i);
     void remove_relation(const type::relation& relation);
 
     const type::relations& relations() const;
+    const type::relation& relation(std::size_t index) const;
     const type::persons* relations(type::person i) const;
 
     const type::persons& infected() const;
@@ -40,6 +46,23 @@ class population {
     unsigned int run_iteration(unsigned int virality);
 
   private:
+    // the relations in a vector to draw one by index, built on the first draw
+    // and dropped by any change. Copies, mostly made to remove relations from,
+    // start without it
+    class relation_index {
+      public:
+        relation_index() = default;
+        relation_index(const relation_index&) {}
+
+        const type::relation& at(const type::relations& relations, std::size_t index) const;
+        void reset();
+        std::size_t footprint() const;
+      private:
+        mutable std::mutex mutex_;
+        mutable std::atomic_bool built_ = false;
+        mutable std::vector<type::relation> relations_;
+    };
+
     void update_infected(const type::relation& relation);
     void update_infected(type::person i);
 
@@ -47,6 +70,7 @@ class population {
     type::adjacents relations_;
     type::adjacents infected_relations_;
     type::relations all_relations_;
+    relation_index relation_index_;
     type::persons all_infected_;
 };
 
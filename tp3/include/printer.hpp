@@ -0,0 +1,39 @@
+#ifndef INCLUDE_PRINTER_HPP
+#define INCLUDE_PRINTER_HPP
+
+#include <population.hpp>
+#include <relation_set.hpp>
+#include <solution_sink.hpp>
+
+#include <chrono>
+#include <filesystem>
+#include <memory>
+#include <optional>
+#include <string>
+
+namespace tp {
+
+class printer {
+  public:
+    printer(bool print_solutions, bool print_timestamp, bool print_bound);
+    virtual ~printer();
+
+    void start();
+    void set_lower_bound(unsigned int bound);
+    void set_output(const std::filesystem::path& path);
+    std::optional<std::string> close_output();
+    virtual void print(unsigned int cost, const relation_set& isolations);
+    bool printed() const;
+  private:
+    const bool print_solutions_;
+    const bool print_timestamp_;
+    const bool print_bound_;
+    std::optional<unsigned int> lower_bound_;
+    bool printed_;
+    std::chrono::time_point<std::chrono::high_resolution_clock> start_time_;
+    std::unique_ptr<solution_sink> output_;
+};
+
+} /* namespace tp */
+
+#endif /* INCLUDE_PRINTER_HPP */
@@ -0,0 +1,85 @@
+#ifndef INCLUDE_RELATION_SET_HPP
+#define INCLUDE_RELATION_SET_HPP
+
+#include <population.hpp>
+
+#include <cstddef>
+#include <iterator>
+#include <memory>
+#include <vector>
+
+namespace tp {
+
+/*
+ * Sorted set of relations stored as immutable chunks shared between copies.
+ * Copying only copies the chunk pointers and an edit clones the one chunk it
+ * touches, so a mutated chromosome costs memory in proportion to its edits
+ * rather than to its isolation count.
+ */
+class relation_set {
+  private:
+    using chunk = std::vector<type::relation>;
+    using chunks = std::vector<std::shared_ptr<const chunk>>;
+  public:
+    class iterator {
+      public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = type::relation;
+        using difference_type = std::ptrdiff_t;
+        using pointer = const type::relation*;
+        using reference = const type::relation&;
+
+        iterator() = default;
+        iterator(const chunks* chunks, std::size_t chunk, std::size_t offset);
+
+        reference operator*() const;
+        pointer operator->() const;
+        iterator& operator++();
+        iterator operator++(int);
+        bool operator==(const iterator& other) const;
+      private:
+        const chunks* chunks_ = nullptr;
+        std::size_t chunk_ = 0;
+        std::size_t offset_ = 0;
+    };
+
+    using const_iterator = iterator;
+    using value_type = type::relation;
+
+    relation_set() = default;
+    relation_set(const type::relations& relations);
+    static relation_set from_sorted(const std::vector<type::relation>& sorted);
+
+    std::size_t size() const;
+    bool empty() const;
+    bool contains(const type::relation& relation) const;
+    const type::relation& nth(std::size_t index) const;
+    iterator begin() const;
+    iterator end() const;
+
+    bool insert(const type::relation& relation);
+    bool erase(const type::relation& relation);
+
+    type::relations relations() const;
+    std::size_t chunk_count() const;
+    std::size_t shared_chunks(const relation_set& other) const;
+    std::size_t footprint() const;
+    static std::size_t footprint(const std::vector<const relation_set*>& sets);
+
+    bool operator==(const relation_set& other) const;
+    bool operator==(const type::relations& other) const;
+  private:
+    static constexpr std::size_t k_chunk_size = 64;
+
+    static std::size_t chunk_footprint(const chunk& values);
+
+    std::size_t find_chunk(const type::relation& relation) const;
+    chunk& own(std::size_t index);
+
+    chunks chunks_;
+    std::size_t size_ = 0;
+};
+
+} /* namespace tp */
+
+#endif /* INCLUDE_RELATION_SET_HPP */
@@ -0,0 +1,70 @@
+#ifndef INCLUDE_SERVER_HPP
+#define INCLUDE_SERVER_HPP
+
+#include <engine.hpp>
+#include <population.hpp>
+#include <settings.hpp>
+
+#include <atomic>
+#include <filesystem>
+#include <list>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace tp {
+
+/*
+ * Keeps populations loaded and solves them for the clients of a Unix socket.
+ * Each client sends one command per line:
+ *
+ *   load NAME PATH                    load the dataset at PATH as NAME
+ *   infected NAME [PERSON]...         replace the infected people of NAME
+ *   solve NAME VIRALITY SECONDS [ENGINE]
+ *                                     solve NAME in the background
+ *   cancel                            stop the running solve
+ *   quit                              close the connection
+ *
+ * Commands are answered by "ok" or "error REASON". A solve sends a
+ * "solution COST I J I J..." line for each improvement and "done COST", or
+ * "done -" when no solution was found, once it stops. When serve() returns,
+ * every connection has been closed and every solve stopped.
+ */
+class server {
+  public:
+    server(const settings& defaults, unsigned int chains);
+    ~server();
+
+    std::optional<std::string> serve(const std::filesystem::path& path);
+    void stop();
+  private:
+    class session;
+
+    struct client {
+      std::unique_ptr<session> state;
+      std::thread thread;
+      std::atomic_bool done = false;
+    };
+
+    void reap();
+    void close_clients();
+    void handle(session& session);
+    std::string execute(session& session, const std::vector<std::string>& command);
+    std::shared_ptr<const population> find(const std::string& name);
+
+    const settings& defaults_;
+    const unsigned int chains_;
+    std::atomic_bool running_;
+    std::atomic_int listener_;
+    std::list<client> clients_;
+    std::mutex populations_mutex_;
+    std::map<std::string, std::shared_ptr<const population>> populations_;
+};
+
+} /* namespace tp */
+
+#endif /* INCLUDE_SERVER_HPP */
@@ -1,6 +1,10 @@
 #ifndef INCLUDE_SETTINGS_HPP
 #define INCLUDE_SETTINGS_HPP
 
+#include <tbb/enumerable_thread_specific.h>
+
+#include <mutex>
+#include <optional>
 #include <random>
 #include <utility>
 #include <vector>
@@ -9,9 +13,27 @@ namespace tp {
 
 class settings {
   public:
+    /*
+     * While it lives, the random draws of the calling thread come from a
+     * stream depending only on the seed, the batch and the index, so that a
+     * seeded run does not depend on which thread runs which task. A task of
+     * a parallel loop opens one with the batch of the loop and its own index.
+     * Without a seed it does nothing.
+     */
+    class stream {
+      public:
+        stream(settings& settings, unsigned int batch, unsigned int index);
+        ~stream();
+      private:
+        settings& settings_;
+        std::optional<std::mt19937> previous_;
+    };
+
     settings(unsigned int virality);
+    settings(const settings& other);
     virtual bool binary_random();
     virtual unsigned int percent_random();
+    virtual float unit_random();
     virtual unsigned int random_to(unsigned int upper);
     virtual std::pair<unsigned int, unsigned int> random_pair(unsigned max);
 
@@ -26,17 +48,42 @@ class settings {
 
     virtual unsigned int cross_count() const;
     virtual unsigned int mutation_count() const;
+    virtual unsigned int mutation_add_max() const;
+    virtual unsigned int mutation_remove_max() const;
+    virtual unsigned int mutation_update_max() const;
+    virtual unsigned int increase_add_max() const;
+    virtual bool adaptive() const;
+
+    void set_virality(unsigned int virality);
+    void set_chromosome_count(unsigned int count);
+    void set_cross_count(unsigned int count);
+    void set_mutation_count(unsigned int count);
+    void set_mutation_max(unsigned int add, unsigned int remove, unsigned int update);
+    void set_increase_add_max(unsigned int add);
+    void set_adaptive(bool adaptive);
+    void set_seed(unsigned int seed);
+    unsigned int next_batch();
   protected:
     const float initial_isolation_factor_;
-    const unsigned int chromosome_count_;
-    const unsigned int virality_;
+    unsigned int chromosome_count_;
+    unsigned int virality_;
+
+    unsigned int cross_count_;
+    unsigned int mutation_count_;
+    unsigned int mutation_add_max_;
+    unsigned int mutation_remove_max_;
+    unsigned int mutation_update_max_;
+    unsigned int increase_add_max_;
+    bool adaptive_;
 
-    const unsigned int cross_count_;
-    const unsigned int mutation_count_;
+    std::mt19937 make_generator();
+    std::mt19937& generator();
 
+    std::mutex random_device_mutex_;
     std::random_device random_device_;
-    std::mt19937 generator_;
-    std::uniform_int_distribution<unsigned int> uniform_;
+    std::optional<unsigned int> seed_;
+    unsigned int batches_;
+    tbb::enumerable_thread_specific<std::mt19937> generators_;
 };
 
 } /* namespace tp */
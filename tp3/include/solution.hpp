@@ -0,0 +1,48 @@
+#ifndef INCLUDE_SOLUTION_HPP
+#define INCLUDE_SOLUTION_HPP
+
+#include <contagion.hpp>
+#include <population.hpp>
+
+#include <filesystem>
+#include <istream>
+#include <optional>
+#include <string>
+#include <variant>
+#include <vector>
+
+namespace tp::type {
+
+struct verdict {
+  bool valid = false;
+  unsigned int cost = 0;
+  float infected_percent = 0;
+  std::optional<std::string> reason;
+};
+
+} /* namespace tp::type */
+
+namespace tp {
+
+/*
+ * Isolations read back from the output of --solutions: one "i j" relation per
+ * line, solutions separated by empty lines. Only the last solution is kept,
+ * as scripts/check_sol.py does.
+ */
+class solution {
+  public:
+    static std::variant<solution, std::string> from_file(const std::filesystem::path& path);
+    static std::variant<solution, std::string> parse(std::istream& input);
+
+    const std::vector<type::relation>& isolations() const;
+    type::relations relations() const;
+    type::verdict verify(const contagion& contagion, unsigned int virality) const;
+  private:
+    solution(std::vector<type::relation>&& isolations);
+
+    std::vector<type::relation> isolations_;
+};
+
+} /* namespace tp */
+
+#endif /* INCLUDE_SOLUTION_HPP */
@@ -0,0 +1,51 @@
+#ifndef INCLUDE_SOLUTION_SINK_HPP
+#define INCLUDE_SOLUTION_SINK_HPP
+
+#include <population.hpp>
+#include <relation_set.hpp>
+
+#include <condition_variable>
+#include <filesystem>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <thread>
+#include <utility>
+
+namespace tp {
+
+/*
+ * Writes the latest solution to a file from a background thread, so that the
+ * search never waits on I/O. A solution submitted while the previous one is
+ * being written replaces any solution still pending, and each file is written
+ * to a temporary path first then renamed, so readers never see a partial one.
+ * Solutions are shared copy-on-write sets, so submitting one copies no
+ * relation and formatting them happens on the writer thread.
+ */
+class solution_sink {
+  public:
+    solution_sink(const std::filesystem::path& path);
+    ~solution_sink();
+
+    void submit(unsigned int cost, const relation_set& isolations);
+    std::optional<std::string> close();
+    unsigned int written() const;
+
+    static std::string format(const relation_set& isolations);
+  private:
+    void run();
+    std::optional<std::string> write(const relation_set& isolations) const;
+
+    const std::filesystem::path path_;
+    mutable std::mutex mutex_;
+    std::condition_variable wake_;
+    std::optional<std::pair<unsigned int, relation_set>> pending_;
+    bool closing_ = false;
+    unsigned int written_ = 0;
+    std::optional<std::string> error_;
+    std::thread thread_;
+};
+
+} /* namespace tp */
+
+#endif /* INCLUDE_SOLUTION_SINK_HPP */
@@ -0,0 +1,59 @@
+#ifndef INCLUDE_STATISTICS_HPP
+#define INCLUDE_STATISTICS_HPP
+
+#include <population.hpp>
+#include <relation_set.hpp>
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <optional>
+#include <string>
+#include <variant>
+#include <vector>
+
+namespace tp::type {
+
+struct generation_stats {
+  unsigned int generation = 0;
+  std::chrono::microseconds elapsed{0};
+  std::chrono::microseconds mutate{0};
+  std::chrono::microseconds cross{0};
+  std::chrono::microseconds evaluate{0};
+  unsigned int crosses = 0;
+  unsigned int mutations = 0;
+  unsigned int evaluations = 0;
+  unsigned int invalids = 0;
+  unsigned int cached = 0;
+  unsigned int inferred = 0;
+  unsigned int aborted = 0;
+  unsigned int chromosomes = 0;
+  float diversity = 0;
+  std::uint64_t allocations = 0;
+  std::uint64_t allocated_bytes = 0;
+  std::size_t isolation_bytes = 0;
+  std::size_t peak_rss = 0;
+  std::optional<unsigned int> best_cost;
+};
+
+} /* namespace tp::type */
+
+namespace tp {
+
+class statistics {
+  public:
+    static std::variant<statistics, std::string> from_file(const std::filesystem::path& path);
+    static float diversity(const std::vector<const relation_set*>& isolations);
+
+    void record(const type::generation_stats& stats);
+  private:
+    statistics(std::ofstream&& file);
+
+    std::ofstream file_;
+};
+
+} /* namespace tp */
+
+#endif /* INCLUDE_STATISTICS_HPP */
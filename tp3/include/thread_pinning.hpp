@@ -0,0 +1,33 @@
+#ifndef INCLUDE_THREAD_PINNING_HPP
+#define INCLUDE_THREAD_PINNING_HPP
+
+#include <tbb/task_scheduler_observer.h>
+
+#include <sched.h>
+
+#include <atomic>
+#include <vector>
+
+namespace tp {
+
+/*
+ * Pins each thread joining a TBB arena to its own core, taken in turn from
+ * the cores the process is allowed to run on.
+ */
+class thread_pinning : public tbb::task_scheduler_observer {
+  public:
+    thread_pinning();
+    ~thread_pinning();
+
+    unsigned int core_count() const;
+    void on_scheduler_entry(bool) override;
+
+    static std::vector<int> cores(const cpu_set_t& set);
+  private:
+    std::vector<int> cores_;
+    std::atomic_uint next_;
+};
+
+} /* namespace tp */
+
+#endif /* INCLUDE_THREAD_PINNING_HPP */
@@ -0,0 +1,47 @@
+#ifndef INCLUDE_TRACE_HPP
+#define INCLUDE_TRACE_HPP
+
+#include <atomic>
+#include <chrono>
+#include <filesystem>
+#include <optional>
+#include <string>
+
+namespace tp::trace {
+
+extern std::atomic_bool enabled_;
+
+inline bool enabled() {
+  return enabled_.load(std::memory_order_relaxed);
+}
+
+void enable();
+std::optional<std::string> write(const std::filesystem::path& path);
+
+class span {
+  public:
+    span(const char* name) : name_(nullptr) {
+      if (enabled()) {
+        name_ = name;
+        start_ = std::chrono::steady_clock::now();
+      }
+    }
+
+    ~span() {
+      if (name_ != nullptr) {
+        record();
+      }
+    }
+
+    span(const span&) = delete;
+    span& operator=(const span&) = delete;
+  private:
+    void record() const;
+
+    const char* name_;
+    std::chrono::steady_clock::time_point start_;
+};
+
+} /* namespace tp::trace */
+
+#endif /* INCLUDE_TRACE_HPP */
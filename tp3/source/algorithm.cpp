@@ -1,20 +1,31 @@
 #include <algorithm.hpp>
 #include <chromosome.hpp>
 #include <chromosome_parallel.hpp>
+#include <contagion.hpp>
+#include <criteria.hpp>
+#include <memory.hpp>
+#include <operator_rates.hpp>
 #include <population.hpp>
+#include <printer.hpp>
+#include <relation_set.hpp>
 #include <settings.hpp>
+#include <statistics.hpp>
+#include <trace.hpp>
 
+#include <algorithm>
 #include <chrono>
 #include <iostream>
 
 namespace tp {
 
-algorithm::algorithm(bool print_solutions, bool print_timestamp, settings& settings, const population& pop)
-  : print_solutions_(print_solutions), print_timestamp_(print_timestamp), 
-    running_(false), settings_(settings), population_(pop) {
+algorithm::algorithm(printer& printer, settings& settings, criteria& criteria,
+                     statistics* statistics, const population& pop)
+  : printer_(printer),
+    running_(true), settings_(settings), criteria_(criteria), statistics_(statistics),
+    population_(pop), contagion_(pop) {
 
-  for (auto i = 0; i < settings_.chromosome_count(); i++) {
-    chromosomes_.insert(new chromosome(settings_, population_));
+  if (settings_.adaptive()) {
+    operator_rates_.emplace(settings_);
   }
 }
 
@@ -22,45 +33,52 @@ algorithm::~algorithm() {
   std::for_each(chromosomes_.begin(), chromosomes_.end(), std::default_delete<chromosome>());
 }
 
+void algorithm::inject(const type::relations& isolations) {
+  injected_.push_back(isolations);
+}
+
 void algorithm::run() {
-  running_ = true;
   start_time_ = std::chrono::high_resolution_clock::now();
+  criteria_.start();
+  printer_.start();
 
-  bool best_is_set = false;
-  type::solution best;
+  if (chromosomes_.empty()) {
+    seed_chromosomes();
+  }
 
-  while(running_) {
-    auto current = evolve();
-    if (current.second == nullptr) {
-      continue;
-    }
+  while(running_ && !criteria_.done(best_cost_)) {
+    trace::span span("generation");
+    type::generation_stats stats;
+    auto allocations = memory::allocations();
+    auto current = evolve(stats);
+    bool improved = false;
 
-    if (!best_is_set) {
-      best_is_set = true;
-      best = current;
-      print_solution(best);
-      continue;
+    if (current.second != nullptr && (!best_cost_ || current.first < best_cost_.value())) {
+      improved = true;
+      best_cost_ = current.first;
+      best_isolations_ = current.second->isolations();
+      printer_.print(best_cost_.value(), best_isolations_);
     }
 
-    if (current.first < best.first) {
-      best = current;
-      print_solution(best);
+    criteria_.next_generation(improved);
+
+    if (statistics_ != nullptr) {
+      stats.generation = criteria_.generation();
+      stats.elapsed = std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::high_resolution_clock::now() - start_time_
+      );
+      stats.best_cost = best_cost_;
+
+      auto allocated = memory::allocations() - allocations;
+      stats.allocations = allocated.count;
+      stats.allocated_bytes = allocated.bytes;
+      stats.peak_rss = memory::peak_rss();
+      statistics_->record(stats);
     }
   }
-}
 
-void algorithm::print_solution(const type::solution& solution) const {
-  if (print_solutions_) {
-    std::string output;
-    for (auto isolation : solution.second->isolations()) {
-      output += std::to_string(isolation.first) + " " + std::to_string(isolation.second) + "\n";
-    }
-    std::cout << std::endl << output;
-  } else if  (print_timestamp_) {
-    auto elapsed = std::chrono::high_resolution_clock::now() - start_time_;
-    std::cout << solution.first << " " << elapsed.count() << std::endl;
-  } else {
-    std::cout << solution.first << std::endl;
+  if (best_cost_) {
+    printer_.print(best_cost_.value(), best_isolations_);
   }
 }
 
@@ -68,24 +86,74 @@ void algorithm::stop() {
   running_ = false;
 }
 
-type::solution algorithm::evolve() {
-  mutate_random_chromosomes();
-  cross_random_chromosomes();
+const type::chromosomes& algorithm::chromosomes() const {
+  return chromosomes_;
+}
+
+type::solution algorithm::evolve(type::generation_stats& stats) {
+  using clock = std::chrono::high_resolution_clock;
+  using std::chrono::duration_cast;
+  using std::chrono::microseconds;
 
+  auto mutate_start = clock::now();
+  {
+    trace::span span("mutate phase");
+    mutate_random_chromosomes();
+  }
+
+  auto cross_start = clock::now();
+  {
+    trace::span span("cross phase");
+    cross_random_chromosomes();
+  }
+
+  auto evaluate_start = clock::now();
   std::vector<chromosome*> chromosomes_vector(chromosomes_.begin(), chromosomes_.end());
-  parallel::chromosome_costs chromosome_costs;
-  chromosome_costs(chromosomes_vector, population_.relations().size());
+  parallel::chromosome_costs chromosome_costs(contagion_);
+  {
+    trace::span span("evaluate phase");
+    chromosome_costs(chromosomes_vector, population_.relations().size());
+  }
+  auto evaluate_end = clock::now();
+
+  stats.mutate = duration_cast<microseconds>(cross_start - mutate_start);
+  stats.cross = duration_cast<microseconds>(evaluate_start - cross_start);
+  stats.evaluate = duration_cast<microseconds>(evaluate_end - evaluate_start);
+  stats.crosses = crossed_.size() / 2;
+  stats.mutations = mutated_.size();
+  stats.evaluations = chromosomes_vector.size();
+  stats.invalids = chromosome_costs.invalids().size();
+  stats.cached = chromosome_costs.screened(type::screening::cached);
+  stats.inferred = chromosome_costs.screened(type::screening::inferred);
+  stats.aborted = chromosome_costs.screened(type::screening::aborted);
 
+  trace::span span("select phase");
   type::chromosomes removed;
   remove_worst_chromosomes(removed, chromosome_costs.costs());
   replace_invalid_chromosomes(removed, chromosome_costs.invalids());
+  update_operator_rates(chromosome_costs.invalids());
+
+  if (statistics_ != nullptr) {
+    std::vector<const relation_set*> isolations;
+    for (auto chromosome : chromosomes_) {
+      isolations.push_back(&chromosome->isolations());
+    }
+
+    stats.chromosomes = chromosomes_.size();
+    stats.diversity = statistics::diversity(isolations);
+    stats.isolation_bytes = relation_set::footprint(isolations);
+  }
   
   std::for_each(removed.begin(), removed.end(), std::default_delete<chromosome>());
-  if (removed.size() == chromosomes_vector.size()) {
-    return {0, nullptr};
+
+  const auto& invalids = chromosome_costs.invalids();
+  for (const auto& solution : chromosome_costs.costs()) {
+    if (!invalids.contains(solution.second) && !removed.contains(solution.second)) {
+      return solution;
+    }
   }
 
-  return *chromosome_costs.costs().begin();
+  return {0, nullptr};
 }
 
 void algorithm::remove_worst_chromosomes(type::chromosomes& removed, const type::chromosome_costs& costs) {
@@ -112,13 +180,58 @@ void algorithm::replace_invalid_chromosomes(type::chromosomes& removed, const ty
 }
 
 
+void algorithm::seed_chromosomes() {
+  trace::span span("seed phase");
+
+  unsigned int count = settings_.chromosome_count();
+  for (const auto& isolations : injected_) {
+    auto injected = new chromosome(settings_, population_, isolations);
+    adopt(injected);
+
+    // variants keep the population diverse around the injected solution
+    for (unsigned int i = 0; i < k_injected_variants && chromosomes_.size() < count; i++) {
+      unsigned int add = 1 + settings_.random_to(settings_.mutation_add_max());
+      unsigned int update = 1 + settings_.random_to(settings_.mutation_update_max());
+      adopt(injected->mutate(add, 0, update));
+    }
+  }
+
+  count -= std::min<unsigned int>(count, chromosomes_.size());
+
+  std::vector<parallel::seed_settings> seed_settings;
+  for (unsigned int i = 0; i < count; i++) {
+    if (i == 0 || population_.size() == 0) {
+      seed_settings.emplace_back(0, 0, 0);
+    } else if (i == 1) {
+      seed_settings.emplace_back(std::nullopt, 0, 0);
+    } else {
+      std::optional<type::person> root;
+      if (settings_.random_to(3) != 0) {
+        root = settings_.random_to(population_.size() - 1);
+      }
+
+      unsigned int add = settings_.random_to(settings_.mutation_add_max());
+      unsigned int remove = settings_.random_to(settings_.mutation_remove_max());
+      seed_settings.emplace_back(root, add, remove);
+    }
+  }
+
+  parallel::chromosome_seed chromosome_seed(settings_, population_);
+  chromosome_seed(seed_settings);
+
+  const auto& c = chromosome_seed.created();
+  for_each(c.begin(), c.end(), [&](auto c) { adopt(c); });
+}
+
 void algorithm::cross_random_chromosomes() {
   if (chromosomes_.size() < 2) {
     return;
   }
 
+  auto cross_count = operator_rates_ ? operator_rates_->cross_count() : settings_.cross_count();
+
   std::vector<parallel::cross_settings> cross_settings;
-  for (auto n = 0; n < settings_.cross_count(); n++) {
+  for (unsigned int n = 0; n < cross_count; n++) {
     auto [i, j] = settings_.random_pair(chromosomes_.size() - 1);
     auto it_i = chromosomes_.begin();
     auto it_j = chromosomes_.begin();
@@ -127,11 +240,12 @@ void algorithm::cross_random_chromosomes() {
     cross_settings.emplace_back(*it_i, *it_j);
   }
 
-  parallel::chromosome_cross chromosome_cross;
+  parallel::chromosome_cross chromosome_cross(settings_);
   chromosome_cross(cross_settings);
 
   const auto& c = chromosome_cross.created();
-  for_each(c.begin(), c.end(), [&](auto c) { chromosomes_.insert(c); });
+  for_each(c.begin(), c.end(), [&](auto c) { adopt(c); });
+  crossed_.insert(c.begin(), c.end());
 }
 
 void algorithm::mutate_random_chromosomes() {
@@ -139,29 +253,57 @@ void algorithm::mutate_random_chromosomes() {
     return;
   }
 
+  auto mutation_count = operator_rates_ ? operator_rates_->mutation_count() : settings_.mutation_count();
+
   std::vector<parallel::mutation_settings> mutation_settings;
-  for (auto i = 0; i < settings_.mutation_count(); i++) {
+  for (unsigned int i = 0; i < mutation_count; i++) {
     auto it = chromosomes_.begin();
     std::advance(it, settings_.random_to(chromosomes_.size() - 1));
 
-    unsigned int add = settings_.random_to(10);
-    unsigned int remove = settings_.random_to(10);
-    unsigned int update = settings_.random_to(10);
+    unsigned int add = settings_.random_to(settings_.mutation_add_max());
+    unsigned int remove = settings_.random_to(settings_.mutation_remove_max());
+    unsigned int update = settings_.random_to(settings_.mutation_update_max());
     mutation_settings.emplace_back(*it, add, remove, update);
   }
 
-  parallel::chromosome_mutate chromosome_mutate;
+  parallel::chromosome_mutate chromosome_mutate(settings_);
   chromosome_mutate(mutation_settings);
 
   const auto& c = chromosome_mutate.created();
-  for_each(c.begin(), c.end(), [&](auto c) { chromosomes_.insert(c); });
+  for_each(c.begin(), c.end(), [&](auto c) { adopt(c); });
+  mutated_.insert(c.begin(), c.end());
 }
 
 void algorithm::mutate_increase_chromosome(chromosome* chromosome) {
-  unsigned int add = settings_.random_to(20);
+  unsigned int add = settings_.random_to(settings_.increase_add_max());
   unsigned int remove = 0;
   unsigned int update = 0;
-  chromosomes_.insert(chromosome->mutate(add, remove, update));
+  adopt(chromosome->mutate(add, remove, update));
+}
+
+// numbers the chromosome in the order it joins the population, which the
+// population is sorted by
+void algorithm::adopt(chromosome* chromosome) {
+  chromosome->set_serial(next_serial_++);
+  chromosomes_.insert(chromosome);
+}
+
+void algorithm::update_operator_rates(const type::chromosomes& invalids) {
+  if (operator_rates_) {
+    auto successes = [&](const type::chromosomes& created) {
+      return std::count_if(created.begin(), created.end(), [&](auto c) {
+        return chromosomes_.contains(c) && !invalids.contains(c);
+      });
+    };
+
+    operator_rates_->update(
+      crossed_.size(), successes(crossed_),
+      mutated_.size(), successes(mutated_)
+    );
+  }
+
+  crossed_.clear();
+  mutated_.clear();
 }
 
 } /* namespace tp */
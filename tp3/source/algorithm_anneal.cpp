@@ -0,0 +1,319 @@
+#include <algorithm_anneal.hpp>
+#include <algorithm_greedy.hpp>
+#include <chromosome.hpp>
+#include <contagion.hpp>
+#include <criteria.hpp>
+#include <population.hpp>
+#include <printer.hpp>
+#include <settings.hpp>
+#include <trace.hpp>
+
+#include <tbb/parallel_for.h>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <vector>
+
+namespace tp {
+
+algorithm_anneal::algorithm_anneal(printer& printer, settings& settings, criteria& criteria,
+                                   const population& pop, mode mode, unsigned int chains)
+  : printer_(printer), settings_(settings), criteria_(criteria), population_(pop),
+    contagion_(pop), mode_(mode), chain_count_(std::max(chains, 1u)),
+    limit_(pop.size() / 2), running_(true) {}
+
+void algorithm_anneal::run() {
+  criteria_.start();
+  printer_.start();
+
+  auto initial = algorithm_greedy(printer_, settings_, population_).solve();
+
+  chains_.clear();
+  chains_.reserve(chain_count_);
+  for (unsigned int i = 0; i < chain_count_; i++) {
+    chains_.push_back(make_chain(initial));
+  }
+
+  bool improved = true;
+  while (running_) {
+    if (improved) {
+      for (auto& chain : chains_) {
+        if (chain.best_cost && (!best_cost_ || chain.best_cost.value() < best_cost_.value())) {
+          best_cost_ = chain.best_cost;
+          best_isolations_ = chain.best_isolations;
+        }
+      }
+
+      if (best_cost_) {
+        printer_.print(best_cost_.value(), best_isolations_);
+      }
+    }
+
+    if (criteria_.done(best_cost_)) {
+      break;
+    }
+
+    trace::span span("generation");
+
+    auto previous_cost = best_cost_;
+    unsigned int batch = settings_.next_batch();
+    tbb::parallel_for(
+      tbb::blocked_range<std::vector<chain>::iterator>(
+        chains_.begin(),
+        chains_.end()
+      ),
+      [&] (auto range) {
+        std::for_each(
+          range.begin(),
+          range.end(),
+          [&] (chain& chain) {
+            settings::stream stream(settings_, batch, &chain - chains_.data());
+            if (mode_ == mode::anneal) {
+              anneal(chain);
+            } else {
+              tabu(chain);
+            }
+          }
+        );
+      }
+    );
+
+    improved = false;
+    for (auto& chain : chains_) {
+      if (chain.best_cost && (!previous_cost || chain.best_cost.value() < previous_cost.value())) {
+        improved = true;
+      }
+    }
+
+    criteria_.next_generation(improved);
+  }
+}
+
+void algorithm_anneal::stop() {
+  running_ = false;
+}
+
+algorithm_anneal::chain algorithm_anneal::make_chain(const type::relations& isolations) const {
+  chain chain{
+    chromosome(settings_, population_, isolations),
+    contagion_.isolated(isolations),
+    {},
+    0,
+    k_initial_temperature,
+    0,
+    0,
+    std::vector<unsigned long>(contagion_.relation_count(), 0),
+    {},
+    {}
+  };
+
+  chain.infected = contagion_.run(settings_.virality(), chain.isolated, &chain.rounds);
+  update_best(chain);
+  return chain;
+}
+
+void algorithm_anneal::anneal(chain& chain) const {
+  trace::span span("anneal");
+  candidate result;
+
+  for (unsigned int step = 0; step < k_anneal_steps && running_; step++) {
+    float current = energy(chain.current.isolations().size(), chain.infected);
+
+    auto move = random_move(chain);
+    if (!evaluate(chain, move, result)) {
+      continue;
+    }
+
+    float delta = result.energy - current;
+    if (delta <= 0 || settings_.unit_random() < std::exp(-delta / chain.temperature)) {
+      accept(chain, result);
+    } else {
+      reject(chain, move);
+    }
+
+    chain.temperature *= k_cooling;
+    if (chain.temperature < k_final_temperature) {
+      chain.temperature = k_initial_temperature;
+    }
+  }
+}
+
+void algorithm_anneal::tabu(chain& chain) const {
+  trace::span span("tabu");
+  candidate result;
+  candidate best;
+
+  auto is_tabu = [&] (const std::optional<type::relation>& relation) {
+    return relation && chain.tabu_until[contagion_.relation_id(*relation).value()] > chain.iteration;
+  };
+
+  for (unsigned int step = 0; step < k_tabu_steps && running_; step++) {
+    bool found = false;
+
+    for (unsigned int i = 0; i < k_tabu_candidates; i++) {
+      auto move = random_move(chain);
+      if (!evaluate(chain, move, result)) {
+        continue;
+      }
+
+      unsigned int cost = chain.current.isolations().size();
+      bool aspiration = result.infected <= limit_ && (!chain.best_cost || cost < chain.best_cost.value());
+      bool admissible = aspiration || (!is_tabu(move.added) && !is_tabu(move.removed));
+
+      reject(chain, move);
+
+      if (admissible && (!found || result.energy < best.energy)) {
+        std::swap(best, result);
+        found = true;
+      }
+    }
+
+    if (found) {
+      chain.current.apply(best.move);
+      toggle(chain.isolated, best.move, true);
+      accept(chain, best);
+
+      unsigned long tenure = k_tabu_tenure + settings_.random_to(k_tabu_tenure);
+      for (const auto& relation : {best.move.added, best.move.removed}) {
+        if (relation) {
+          chain.tabu_until[contagion_.relation_id(*relation).value()] = chain.iteration + tenure;
+        }
+      }
+    }
+
+    chain.iteration++;
+    if (chain.iteration - chain.improved_at > k_tabu_restart) {
+      restart(chain);
+    }
+  }
+}
+
+type::move algorithm_anneal::random_move(chain& chain) const {
+  unsigned int choice = settings_.percent_random();
+
+  if (chain.infected <= limit_) {
+    if (choice < 50) {
+      return chain.current.remove_isolation();
+    } else if (choice < 80) {
+      return chain.current.update_isolation();
+    }
+
+    return chain.current.add_isolation();
+  }
+
+  if (choice < 60) {
+    return chain.current.add_isolation();
+  }
+
+  return chain.current.update_isolation();
+}
+
+bool algorithm_anneal::evaluate(chain& chain, const type::move& move, candidate& result) const {
+  if (!move.added && !move.removed) {
+    return false;
+  }
+
+  // with the people infected by the current isolations known, isolating a
+  // relation only matters between two infected people and releasing one only
+  // matters between an infected and a healthy person
+  const unsigned int healthy = std::numeric_limits<unsigned int>::max();
+  auto infected = [&] (type::person i) {
+    return chain.rounds[i] != healthy;
+  };
+
+  bool changed = settings_.virality() == 0;
+  if (move.removed) {
+    changed |= infected(move.removed->first) != infected(move.removed->second);
+  }
+
+  if (move.added) {
+    changed |= infected(move.added->first) && infected(move.added->second);
+  }
+
+  toggle(chain.isolated, move, true);
+
+  result.move = move;
+  result.rounds.clear();
+  result.infected = chain.infected;
+  if (changed) {
+    result.infected = contagion_.run(settings_.virality(), chain.isolated, &result.rounds);
+  }
+
+  result.energy = energy(chain.current.isolations().size(), result.infected);
+  return true;
+}
+
+void algorithm_anneal::accept(chain& chain, candidate& result) const {
+  if (!result.rounds.empty()) {
+    chain.rounds.swap(result.rounds);
+    chain.infected = result.infected;
+  }
+
+  update_best(chain);
+}
+
+void algorithm_anneal::reject(chain& chain, const type::move& move) const {
+  chain.current.undo(move);
+  toggle(chain.isolated, move, false);
+}
+
+void algorithm_anneal::update_best(chain& chain) const {
+  unsigned int cost = chain.current.isolations().size();
+  if (chain.infected <= limit_ && (!chain.best_cost || cost < chain.best_cost.value())) {
+    chain.best_cost = cost;
+    chain.best_isolations = chain.current.isolations();
+    chain.improved_at = chain.iteration;
+  }
+}
+
+void algorithm_anneal::restart(chain& chain) const {
+  type::relations released;
+  type::relations isolated;
+  const auto& current = chain.current.isolations();
+  const auto& best = chain.best_isolations;
+
+  std::set_difference(current.begin(), current.end(), best.begin(), best.end(),
+                      std::inserter(released, released.begin()));
+  std::set_difference(best.begin(), best.end(), current.begin(), current.end(),
+                      std::inserter(isolated, isolated.begin()));
+
+  for (const auto& relation : released) {
+    chain.current.apply({{}, relation});
+  }
+
+  for (const auto& relation : isolated) {
+    chain.current.apply({relation, {}});
+  }
+
+  chain.isolated = contagion_.isolated(chain.current.isolations());
+  chain.infected = contagion_.run(settings_.virality(), chain.isolated, &chain.rounds);
+  chain.improved_at = chain.iteration;
+}
+
+void algorithm_anneal::toggle(std::vector<bool>& isolated, const type::move& move, bool apply) const {
+  if (apply) {
+    if (move.removed) {
+      isolated[contagion_.relation_id(*move.removed).value()] = false;
+    }
+
+    if (move.added) {
+      isolated[contagion_.relation_id(*move.added).value()] = true;
+    }
+  } else {
+    if (move.added) {
+      isolated[contagion_.relation_id(*move.added).value()] = false;
+    }
+
+    if (move.removed) {
+      isolated[contagion_.relation_id(*move.removed).value()] = true;
+    }
+  }
+}
+
+float algorithm_anneal::energy(unsigned int isolations, unsigned int infected) const {
+  float excess = infected > limit_ ? infected - limit_ : 0;
+  return isolations + k_penalty * excess;
+}
+
+} /* namespace tp */
@@ -1,29 +1,60 @@
 #include <algorithm_basic.hpp>
 
 #include <algorithm>
-#include <deque>
-#include <set>
+#include <vector>
 
 namespace tp {
 
 algorithm_basic::algorithm_basic(settings& settings, const population& pop)
-  : settings_(settings), population_(pop) {}
+  : settings_(settings), population_(pop), span_(pop.size()) {
+
+  for (const auto& relation : population_.relations()) {
+    span_ = std::max(span_, relation.second + 1);
+  }
+
+  if (!population_.infected().empty()) {
+    span_ = std::max(span_, *population_.infected().rbegin() + 1);
+  }
+
+  offsets_.reserve(span_ + 1);
+  offsets_.push_back(0);
+  neighbors_.reserve(2 * population_.relations().size());
+
+  for (type::person i = 0; i < span_; i++) {
+    auto relations = population_.relations(i);
+    if (relations != nullptr) {
+      neighbors_.insert(neighbors_.end(), relations->begin(), relations->end());
+    }
+
+    offsets_.push_back(neighbors_.size());
+  }
+
+  infected_.resize(span_, false);
+  for (auto i : population_.infected()) {
+    infected_[i] = true;
+  }
+}
 
 type::relations algorithm_basic::isolate_infected() const {
   type::relations isolations;
 
-  for (auto i = 0; i < population_.size(); i++) {
-    auto infected = population_.infected(i);
-    if (infected == nullptr) {
-      continue;
+  for (type::person i = 0; i < population_.size(); i++) {
+    unsigned int infected = 0;
+    for (auto k = offsets_[i]; k < offsets_[i + 1]; k++) {
+      infected += infected_[neighbors_[k]];
     }
 
-    if (infected->size() < settings_.virality()) {
+    if (infected == 0 || infected < settings_.virality()) {
       continue;
     }
 
     unsigned int removed = 0;
-    for (auto j : *infected) {
+    for (auto k = offsets_[i]; k < offsets_[i + 1]; k++) {
+      auto j = neighbors_[k];
+      if (!infected_[j]) {
+        continue;
+      }
+
       if (j < i) {
         isolations.emplace(j, i);
       } else {
@@ -32,7 +63,7 @@ type::relations algorithm_basic::isolate_infected() const {
 
       removed++;
 
-      if (infected->size() - removed < settings_.virality()) {
+      if (infected - removed < settings_.virality()) {
         break;
       }
     }
@@ -42,75 +73,82 @@ type::relations algorithm_basic::isolate_infected() const {
 }
 
 type::relations algorithm_basic::isolate_50_percent() const {
-  type::relations isolations;
+  return isolate_50_percent(0);
+}
 
-  std::set<type::person> everybody;
-  for (auto i = 0; i < population_.size(); i++) {
-    everybody.insert(i);
+type::relations algorithm_basic::isolate_50_percent(type::person root) const {
+  type::relations isolations;
+  if (population_.size() == 0) {
+    return isolations;
   }
 
+  std::vector<bool> visited(span_, false);
+  std::vector<bool> good(span_, false);
+  unsigned int good_count = 0;
 
-  std::set<type::person> all_visited;
-  std::set<type::person> good_visited;
-  std::deque<type::person> not_visited;
+  std::vector<type::person> queue;
+  queue.reserve(span_);
+  std::size_t head = 0;
+  type::person unvisited = 0;
 
-  not_visited.push_back(0);
+  queue.push_back(root);
   while (true) {
-    if (not_visited.size() == 0) {
-      std::deque<type::person> remaining;
-      std::set_difference(
-        everybody.begin(), everybody.end(),
-        all_visited.begin(), all_visited.end(),
-        std::inserter(remaining, remaining.begin())
-      );
-      not_visited.push_back(remaining.front());
+    if (head == queue.size()) {
+      while (unvisited < population_.size() && visited[unvisited]) {
+        unvisited++;
+      }
+
+      if (unvisited == population_.size()) {
+        break;
+      }
+
+      queue.push_back(unvisited);
     }
 
-    if (((float) good_visited.size()) / ((float) population_.size()) > 0.60) {
+    if (((float) good_count) / ((float) population_.size()) > 0.60) {
       break;
     }
 
-    auto current = not_visited.front();
-    not_visited.pop_front();
-    all_visited.insert(current);
-
-    if (population_.infected().contains(current)) {
+    auto current = queue[head++];
+    if (visited[current]) {
       continue;
-    } else {
-      good_visited.insert(current);
     }
 
-    auto relations = population_.relations(current);
-    if (relations == nullptr) {
+    visited[current] = true;
+
+    if (infected_[current]) {
       continue;
     }
 
-    for (const auto other : *relations) {
-      not_visited.push_back(other);
+    good[current] = true;
+    good_count++;
+
+    for (auto k = offsets_[current]; k < offsets_[current + 1]; k++) {
+      if (!visited[neighbors_[k]]) {
+        queue.push_back(neighbors_[k]);
+      }
     }
   }
 
-  for (const auto i : good_visited) {
-    auto relations = population_.relations(i);
-    if (relations == nullptr) {
+  for (type::person i = 0; i < span_; i++) {
+    if (!good[i]) {
       continue;
     }
 
-    std::deque<type::person> outside;
-    std::set_difference(
-      relations->begin(), relations->end(),
-      good_visited.begin(), good_visited.end(),
-      std::inserter(outside, outside.begin())
-    );
+    unsigned int outside = 0;
+    for (auto k = offsets_[i]; k < offsets_[i + 1]; k++) {
+      outside += !good[neighbors_[k]];
+    }
 
-    unsigned removed_relation_count = 0;
-    for (const auto j : outside) {
-      if (outside.size() - removed_relation_count < settings_.virality()) {
-        break;
+    unsigned int removed_relation_count = 0;
+    for (auto k = offsets_[i]; k < offsets_[i + 1]; k++) {
+      auto j = neighbors_[k];
+      if (good[j]) {
+        continue;
       }
 
-      if (good_visited.contains(j)) {
-        continue;
+      if (outside - removed_relation_count < settings_.virality()) {
+        break;
       }
 
       removed_relation_count++;
@@ -0,0 +1,259 @@
+#include <algorithm_components.hpp>
+#include <algorithm_greedy.hpp>
+#include <contagion.hpp>
+#include <criteria.hpp>
+#include <population.hpp>
+#include <printer.hpp>
+#include <settings.hpp>
+#include <trace.hpp>
+
+#include <tbb/parallel_for.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <limits>
+#include <numeric>
+#include <vector>
+
+namespace tp {
+
+algorithm_components::algorithm_components(printer& printer, settings& settings, const population& pop,
+                                           criteria* criteria)
+  : printer_(printer), settings_(settings), criteria_(criteria), population_(pop), local_(pop.size(), 0), running_(true) {
+
+  std::vector<type::person> parent(pop.size());
+  std::iota(parent.begin(), parent.end(), 0);
+
+  auto find = [&] (type::person i) {
+    while (parent[i] != i) {
+      parent[i] = parent[parent[i]];
+      i = parent[i];
+    }
+
+    return i;
+  };
+
+  for (const auto& [i, j] : pop.relations()) {
+    if (i < pop.size() && j < pop.size()) {
+      parent[find(i)] = find(j);
+    }
+  }
+
+  std::vector<unsigned int> index(pop.size(), std::numeric_limits<unsigned int>::max());
+  for (type::person i = 0; i < pop.size(); i++) {
+    auto root = find(i);
+    if (index[root] == std::numeric_limits<unsigned int>::max()) {
+      index[root] = components_.size();
+      components_.emplace_back();
+    }
+
+    auto& component = components_[index[root]];
+    local_[i] = component.size();
+    component.push_back(i);
+  }
+}
+
+void algorithm_components::run() {
+  if (criteria_ != nullptr) {
+    criteria_->start();
+  }
+
+  printer_.start();
+
+  auto isolations = solve();
+  if (isolations) {
+    printer_.print(isolations->size(), isolations.value());
+  }
+}
+
+void algorithm_components::stop() {
+  running_ = false;
+}
+
+const std::vector<type::component>& algorithm_components::components() const {
+  return components_;
+}
+
+std::vector<type::curve_point> algorithm_components::curve(const type::component& component) const {
+  trace::span span("component curve");
+
+  population sub(component.size());
+  for (type::person local = 0; local < component.size(); local++) {
+    auto i = component[local];
+
+    auto neighbors = population_.relations(i);
+    if (neighbors != nullptr) {
+      for (auto j : *neighbors) {
+        if (j < population_.size()) {
+          sub.add_relation({local, local_[j]});
+        }
+      }
+    }
+
+    if (population_.infected().contains(i)) {
+      sub.add_infected(local);
+    }
+  }
+
+  contagion contagion(sub);
+  unsigned int initial = sub.infected().size();
+  unsigned int full = contagion.run(settings_.virality(), std::vector<bool>(contagion.relation_count(), false));
+
+  std::vector<type::curve_point> curve{{full, {}}};
+  if (full == initial) {
+    return curve;
+  }
+
+  printer silent(false, false, false);
+  algorithm_greedy greedy(silent, settings_, sub, criteria_, &running_);
+
+  // a greedy solve cut short by the criteria leaves too many infected and is
+  // dropped below, the points found before it are still usable
+  unsigned int steps = std::min(k_curve_points - 1, full - initial);
+  for (unsigned int step = 0; step < steps && running_ && !(criteria_ != nullptr && criteria_->done({})); step++) {
+    unsigned int limit = initial + (full - initial) * step / steps;
+    auto isolations = greedy.solve(limit);
+
+    unsigned int infected = contagion.run(settings_.virality(), isolations);
+    if (infected > limit) {
+      continue;
+    }
+
+    type::relations mapped;
+    for (auto [i, j] : isolations) {
+      mapped.emplace(std::min(component[i], component[j]), std::max(component[i], component[j]));
+    }
+
+    curve.push_back({infected, std::move(mapped)});
+  }
+
+  return curve;
+}
+
+std::optional<type::relations> algorithm_components::solve() {
+  std::vector<std::vector<type::curve_point>> curves(components_.size());
+  tbb::parallel_for(std::size_t(0), components_.size(), [&] (std::size_t c) {
+    curves[c] = curve(components_[c]);
+  });
+
+  if (!running_) {
+    return {};
+  }
+
+  // knapsack over the total of infected people, after the least infected
+  // point of each component, keeping the fewest isolations for each total
+  unsigned int budget = population_.size() / 2;
+  std::vector<choice> choosing;
+  type::relations isolations;
+  for (const auto& curve : curves) {
+    auto [least, most] = std::minmax_element(curve.begin(), curve.end(), [] (const auto& a, const auto& b) {
+      return a.infected < b.infected;
+    });
+
+    if (least->infected > budget) {
+      return {};
+    }
+
+    budget -= least->infected;
+    if (curve.size() > 1) {
+      choosing.push_back({&curve, least->infected, most->infected - least->infected});
+    } else {
+      isolations.insert(curve[0].isolations.begin(), curve[0].isolations.end());
+    }
+  }
+
+  // no total can go past the sum of the ranges of the components
+  unsigned int range = 0;
+  for (const auto& c : choosing) {
+    range = std::min(budget, range + c.range);
+  }
+
+  auto costs = knapsack(choosing, 0, choosing.size(), range);
+  auto best = std::min_element(costs.begin(), costs.end());
+  if (*best == k_none) {
+    return {};
+  }
+
+  std::vector<std::size_t> picked(choosing.size());
+  if (!choosing.empty()) {
+    pick(choosing, 0, choosing.size(), best - costs.begin(), picked);
+  }
+
+  for (std::size_t k = 0; k < choosing.size(); k++) {
+    const auto& point = (*choosing[k].curve)[picked[k]];
+    isolations.insert(point.isolations.begin(), point.isolations.end());
+  }
+
+  return isolations;
+}
+
+// fewest isolations for each total of infected people over the components of
+// [begin, end), past their least infected points and up to limit
+std::vector<unsigned int> algorithm_components::knapsack(const std::vector<choice>& choosing, std::size_t begin,
+                                                         std::size_t end, unsigned int limit) {
+  std::vector<unsigned int> costs{0};
+  for (std::size_t k = begin; k < end; k++) {
+    const auto& c = choosing[k];
+    std::vector<unsigned int> next(std::min<std::size_t>(limit, costs.size() - 1 + c.range) + 1, k_none);
+
+    for (unsigned int total = 0; total < costs.size(); total++) {
+      if (costs[total] == k_none) {
+        continue;
+      }
+
+      for (const auto& point : *c.curve) {
+        unsigned int reached = total + point.infected - c.least;
+        unsigned int cost = costs[total] + point.isolations.size();
+        if (reached < next.size() && cost < next[reached]) {
+          next[reached] = cost;
+        }
+      }
+    }
+
+    costs.swap(next);
+  }
+
+  return costs;
+}
+
+// the point of each component of [begin, end) reaching exactly total with the
+// fewest isolations, splitting the components in halves so that only the
+// costs of each half are kept rather than the choices of every component
+void algorithm_components::pick(const std::vector<choice>& choosing, std::size_t begin, std::size_t end,
+                                unsigned int total, std::vector<std::size_t>& picked) {
+  if (end - begin == 1) {
+    const auto& c = choosing[begin];
+    unsigned int fewest = k_none;
+    for (std::size_t p = 0; p < c.curve->size(); p++) {
+      const auto& point = (*c.curve)[p];
+      if (point.infected - c.least == total && point.isolations.size() < fewest) {
+        fewest = point.isolations.size();
+        picked[begin] = p;
+      }
+    }
+
+    return;
+  }
+
+  std::size_t middle = begin + (end - begin) / 2;
+  auto first = knapsack(choosing, begin, middle, total);
+  auto second = knapsack(choosing, middle, end, total);
+
+  unsigned int split = 0;
+  unsigned int fewest = k_none;
+  for (unsigned int t = 0; t < first.size(); t++) {
+    if (total - t >= second.size() || first[t] == k_none || second[total - t] == k_none) {
+      continue;
+    }
+
+    if (first[t] + second[total - t] < fewest) {
+      fewest = first[t] + second[total - t];
+      split = t;
+    }
+  }
+
+  pick(choosing, begin, middle, split, picked);
+  pick(choosing, middle, end, total - split, picked);
+}
+
+} /* namespace tp */
@@ -0,0 +1,179 @@
+#include <algorithm_greedy.hpp>
+#include <contagion.hpp>
+#include <criteria.hpp>
+#include <population.hpp>
+#include <printer.hpp>
+#include <settings.hpp>
+#include <trace.hpp>
+
+#include <algorithm>
+#include <limits>
+#include <queue>
+#include <tuple>
+#include <vector>
+
+namespace tp {
+
+algorithm_greedy::algorithm_greedy(printer& printer, settings& settings, const population& pop, criteria* criteria,
+                                   const std::atomic_bool* outer_running)
+  : printer_(printer), settings_(settings), criteria_(criteria), outer_running_(outer_running), contagion_(pop),
+    running_(true) {}
+
+void algorithm_greedy::run() {
+  if (criteria_ != nullptr) {
+    criteria_->start();
+  }
+
+  printer_.start();
+
+  auto isolations = solve();
+  if (contagion_.run(settings_.virality(), isolations) <= contagion_.size() / 2) {
+    printer_.print(isolations.size(), isolations);
+  }
+}
+
+void algorithm_greedy::stop() {
+  running_ = false;
+}
+
+type::relations algorithm_greedy::solve() {
+  return solve(contagion_.size() / 2);
+}
+
+type::relations algorithm_greedy::solve(unsigned int limit) {
+  trace::span span("greedy");
+
+  std::vector<bool> isolated(contagion_.relation_count(), false);
+  std::vector<type::relation_id> order;
+
+  while (!stopped()) {
+    auto added = isolate_pressure(isolated, limit);
+    if (added.empty()) {
+      break;
+    }
+
+    order.insert(order.end(), added.begin(), added.end());
+  }
+
+  prune(isolated, order, limit);
+
+  type::relations isolations;
+  for (type::relation_id id = 0; id < isolated.size(); id++) {
+    if (isolated[id]) {
+      isolations.insert(isolations.end(), contagion_.relation(id));
+    }
+  }
+
+  return isolations;
+}
+
+std::vector<type::relation_id> algorithm_greedy::isolate_pressure(std::vector<bool>& isolated, unsigned int limit) const {
+  const unsigned int healthy = std::numeric_limits<unsigned int>::max();
+  const unsigned int virality = settings_.virality();
+
+  std::vector<unsigned int> rounds;
+  auto infected = contagion_.run(virality, isolated, &rounds);
+  if (infected <= limit) {
+    return {};
+  }
+
+  auto infected_before = [&](type::person i, type::person j) {
+    return rounds[i] < rounds[j];
+  };
+
+  // the pressure of a relation is the infections carried by the person it
+  // infects, shared among the relations that must be isolated to protect it
+  std::vector<unsigned int> weight(contagion_.size(), 1);
+  std::vector<unsigned int> excess(contagion_.size(), 0);
+  for (type::person j = 0; j < contagion_.size(); j++) {
+    if (rounds[j] == 0 || rounds[j] == healthy) {
+      continue;
+    }
+
+    unsigned int incoming = 0;
+    for (auto it = contagion_.adjacents_begin(j); it != contagion_.adjacents_end(j); it++) {
+      auto [i, id] = *it;
+      if (isolated[id]) {
+        continue;
+      }
+
+      if (infected_before(i, j)) {
+        incoming++;
+      } else if (rounds[i] != healthy && infected_before(j, i)) {
+        weight[j]++;
+      }
+    }
+
+    excess[j] = incoming - std::min(incoming, virality) + 1;
+  }
+
+  using pressure = std::tuple<float, type::relation_id, type::person, unsigned int>;
+  std::priority_queue<pressure> queue;
+  std::vector<unsigned int> versions(contagion_.size(), 0);
+
+  auto push_incoming = [&](type::person j) {
+    float score = ((float) weight[j]) / ((float) excess[j]);
+    for (auto it = contagion_.adjacents_begin(j); it != contagion_.adjacents_end(j); it++) {
+      auto [i, id] = *it;
+      if (!isolated[id] && infected_before(i, j)) {
+        queue.emplace(score, id, j, versions[j]);
+      }
+    }
+  };
+
+  for (type::person j = 0; j < contagion_.size(); j++) {
+    if (excess[j] != 0) {
+      push_incoming(j);
+    }
+  }
+
+  std::vector<type::relation_id> added;
+  unsigned int needed = infected - limit;
+  unsigned int protected_count = 0;
+
+  while (!queue.empty() && protected_count < needed) {
+    auto [score, id, j, version] = queue.top();
+    queue.pop();
+
+    if (version != versions[j] || excess[j] == 0 || isolated[id]) {
+      continue;
+    }
+
+    isolated[id] = true;
+    added.push_back(id);
+    excess[j]--;
+    versions[j]++;
+
+    if (excess[j] == 0) {
+      protected_count++;
+    } else {
+      push_incoming(j);
+    }
+  }
+
+  return added;
+}
+
+void algorithm_greedy::prune(std::vector<bool>& isolated, const std::vector<type::relation_id>& order, unsigned int limit) const {
+  trace::span span("greedy prune");
+
+  for (auto it = order.rbegin(); it != order.rend() && !stopped(); it++) {
+    isolated[*it] = false;
+    if (contagion_.run(settings_.virality(), isolated) > limit) {
+      isolated[*it] = true;
+    }
+  }
+}
+
+// the greedy search has no cost before it ends, so only the criteria that
+// do not need one, such as the time limit, can stop it. An engine running
+// it as a step passes its own flag, so stopping that engine stops it too
+bool algorithm_greedy::stopped() const {
+  if (!running_ || (outer_running_ != nullptr && !*outer_running_)) {
+    return true;
+  }
+
+  return criteria_ != nullptr && criteria_->done({});
+}
+
+} /* namespace tp */
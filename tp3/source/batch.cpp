@@ -0,0 +1,83 @@
+#include <batch.hpp>
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <map>
+#include <sstream>
+#include <tuple>
+#include <variant>
+#include <vector>
+
+namespace tp {
+
+batch::batch(std::vector<type::job>&& jobs) : jobs_(std::move(jobs)) {}
+
+std::variant<batch, std::string> batch::from_file(const std::filesystem::path& path) {
+  std::ifstream file(path, std::ifstream::in);
+  if (file.fail()) {
+    return strerror(errno);
+  }
+
+  std::vector<type::job> jobs;
+  std::string line;
+  for (unsigned int number = 1; std::getline(file, line); number++) {
+    std::istringstream fields(line);
+    std::string first;
+    if (!(fields >> first) || first[0] == '#') {
+      continue;
+    }
+
+    type::job job;
+    job.dataset = first;
+
+    std::string rest;
+    if (!(fields >> job.virality >> job.seed >> job.seconds) || job.seconds < 0 || (fields >> rest)) {
+      return "line " + std::to_string(number) + ": expected 'dataset virality seed seconds'";
+    }
+
+    jobs.push_back(job);
+  }
+
+  return batch(std::move(jobs));
+}
+
+const std::vector<type::job>& batch::jobs() const {
+  return jobs_;
+}
+
+std::vector<std::string> batch::datasets() const {
+  std::vector<std::string> datasets;
+  for (const auto& job : jobs_) {
+    if (std::find(datasets.begin(), datasets.end(), job.dataset) == datasets.end()) {
+      datasets.push_back(job.dataset);
+    }
+  }
+
+  return datasets;
+}
+
+std::vector<std::vector<std::size_t>> batch::chains() const {
+  // a solution stays valid when the virality increases, so the jobs differing
+  // only by their virality are run in that order to start from each other
+  std::map<std::tuple<std::string, unsigned int, float>, std::vector<std::size_t>> grouped;
+  for (std::size_t i = 0; i < jobs_.size(); i++) {
+    const auto& job = jobs_[i];
+    grouped[{job.dataset, job.seed, job.seconds}].push_back(i);
+  }
+
+  std::vector<std::vector<std::size_t>> chains;
+  for (auto& [key, chain] : grouped) {
+    std::stable_sort(chain.begin(), chain.end(), [&] (auto a, auto b) {
+      return jobs_[a].virality < jobs_[b].virality;
+    });
+
+    chains.push_back(chain);
+  }
+
+  return chains;
+}
+
+} /* namespace tp */
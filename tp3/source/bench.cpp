@@ -0,0 +1,212 @@
+#include <benchmark.hpp>
+#include <chromosome.hpp>
+#include <chromosome_parallel.hpp>
+#include <contagion.hpp>
+#include <population.hpp>
+#include <settings.hpp>
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+#include <iostream>
+#include <optional>
+#include <random>
+#include <string>
+#include <variant>
+#include <vector>
+
+// chromosomes evaluated at once by the chromosome_costs benchmark
+static constexpr unsigned int k_generation_size = 64;
+
+static
+void show_help(FILE* f, const char* exec_name) {
+  fprintf(f, "Usage: %s [OPTION]...\n", exec_name);
+  fprintf(f, "\n");
+  fprintf(f, "Time the hot paths of pandemic on generated populations and print one JSON\n");
+  fprintf(f, "result per line.\n");
+  fprintf(f, "\n");
+  fprintf(f, "  --scale NAME       small, medium, large or all [DEFAULT]\n");
+  fprintf(f, "  --virality N       the propagation rate of the virus [DEFAULT 2]\n");
+  fprintf(f, "  --seed N           seed of the generated populations and operators [DEFAULT 0]\n");
+  fprintf(f, "  --min-time S       time each benchmark for at least S seconds [DEFAULT 0.5]\n");
+  fprintf(f, "  --baseline FILE    compare with the results of a previous run in FILE and\n");
+  fprintf(f, "                     exit with 2 if one got slower; 'make bench' compares\n");
+  fprintf(f, "                     with bench/baseline.json\n");
+  fprintf(f, "  --tolerance P      slowdown in percent tolerated by --baseline [DEFAULT 10]\n");
+  fprintf(f, "  --help             show this help\n");
+}
+
+static
+void fail_usage(const char* exec_name, const char* opt, const char* reason) {
+  fprintf(stderr, "%s: option '%s' %s\n", exec_name, opt, reason);
+  fprintf(stderr, "Try '%s --help' for more information.\n", exec_name);
+  exit(1);
+}
+
+static
+const char* next_arg(const char* exec_name, int argc, char* argv[], int& i) {
+  if (i >= argc - 1) {
+    fail_usage(exec_name, argv[i], "requires an argument");
+  }
+
+  return argv[++i];
+}
+
+static
+float next_positive(const char* exec_name, int argc, char* argv[], int& i) {
+  float value = std::stof(std::string(next_arg(exec_name, argc, argv, i)));
+  if (value < 0) {
+    fail_usage(exec_name, argv[i-1], "requires positive number");
+  }
+
+  return value;
+}
+
+static
+std::vector<tp::type::bench_result> run_scale(const tp::type::bench_scale& scale, unsigned int virality,
+                                              unsigned int seed, std::chrono::duration<double> min_time) {
+  std::vector<tp::type::bench_result> results;
+
+  std::mt19937 generator(seed);
+  tp::population population = tp::benchmark::generate(scale, generator);
+
+  tp::settings settings(virality);
+  settings.set_seed(seed);
+
+  auto dataset = std::filesystem::temp_directory_path() / ("pandemic_bench_" + scale.name + ".txt");
+  if (auto error = tp::benchmark::write(population, dataset)) {
+    fprintf(stderr, "fail to write dataset '%s': %s\n", dataset.c_str(), error->c_str());
+  } else {
+    results.push_back(tp::benchmark::measure("population_from_file", scale.name, min_time, [&] {
+      tp::population::from_file(dataset);
+      return 0;
+    }));
+    std::filesystem::remove(dataset);
+  }
+
+  tp::chromosome base(settings, population);
+  tp::chromosome* other = base.mutate(10, 10, 10);
+  tp::contagion contagion(population);
+  auto isolated = contagion.isolated(base.isolations());
+  auto isolations = base.isolations().relations();
+
+  results.push_back(tp::benchmark::measure("population_run", scale.name, min_time, [&] {
+    population.run(virality, isolations);
+    return 1;
+  }));
+
+  results.push_back(tp::benchmark::measure("contagion_run", scale.name, min_time, [&] {
+    contagion.run(virality, isolated);
+    return 1;
+  }));
+
+  results.push_back(tp::benchmark::measure("chromosome_mutate", scale.name, min_time, [&] {
+    delete base.mutate(3, 3, 3);
+    return 0;
+  }));
+
+  results.push_back(tp::benchmark::measure("chromosome_cross", scale.name, min_time, [&] {
+    auto [child1, child2] = base.cross(other);
+    delete child1;
+    delete child2;
+    return 0;
+  }));
+
+  // chromosomes remember their verdict, so each generation is made of fresh
+  // copies sharing the isolations of the base
+  results.push_back(tp::benchmark::measure("chromosome_costs", scale.name, min_time, [&] {
+    std::vector<tp::chromosome*> chromosomes;
+    for (unsigned int i = 0; i < k_generation_size; i++) {
+      chromosomes.push_back(new tp::chromosome(settings, population, (i % 2 ? other : &base)->isolations()));
+    }
+
+    tp::parallel::chromosome_costs chromosome_costs(contagion);
+    chromosome_costs(chromosomes, population.relations().size());
+
+    for (auto chromosome : chromosomes) {
+      delete chromosome;
+    }
+
+    return k_generation_size;
+  }));
+
+  delete other;
+  return results;
+}
+
+int main(int argc, char* argv[]) {
+  std::optional<std::string> scale_name;
+  unsigned int virality = 2;
+  unsigned int seed = 0;
+  float min_time = 0.5;
+  std::optional<std::string> baseline_file;
+  float tolerance = 10;
+
+  char* exec_name = argv[0];
+  for (int i = 1; i < argc; i++) {
+    if (strcmp("--scale", argv[i]) == 0) {
+      scale_name = next_arg(exec_name, argc, argv, i);
+      if (scale_name == "all") {
+        scale_name.reset();
+      }
+    } else if (strcmp("--virality", argv[i]) == 0) {
+      virality = next_positive(exec_name, argc, argv, i);
+    } else if (strcmp("--seed", argv[i]) == 0) {
+      seed = next_positive(exec_name, argc, argv, i);
+    } else if (strcmp("--min-time", argv[i]) == 0) {
+      min_time = next_positive(exec_name, argc, argv, i);
+    } else if (strcmp("--baseline", argv[i]) == 0) {
+      baseline_file = next_arg(exec_name, argc, argv, i);
+    } else if (strcmp("--tolerance", argv[i]) == 0) {
+      tolerance = next_positive(exec_name, argc, argv, i);
+    } else if (strcmp("--help", argv[i]) == 0) {
+      show_help(stdout, exec_name);
+      exit(0);
+    } else {
+      fprintf(stderr, "%s: unrecognized option '%s'\n", exec_name, argv[i]);
+      fprintf(stderr, "Try '%s --help' for more information.\n", exec_name);
+      exit(1);
+    }
+  }
+
+  std::vector<tp::type::bench_result> baseline;
+  if (baseline_file) {
+    auto loaded = tp::benchmark::load_baseline(baseline_file.value());
+    if (loaded.index()) {
+      fprintf(stderr, "%s: fail to load baseline file '%s': %s\n", exec_name, baseline_file->c_str(),
+              std::get<std::string>(loaded).c_str());
+      exit(1);
+    }
+
+    baseline = std::get<std::vector<tp::type::bench_result>>(loaded);
+  }
+
+  std::vector<const tp::type::bench_scale*> scales;
+  for (const auto& scale : tp::benchmark::scales()) {
+    if (!scale_name || scale.name == scale_name.value()) {
+      scales.push_back(&scale);
+    }
+  }
+
+  if (scales.empty()) {
+    fail_usage(exec_name, "--scale", "requires small, medium, large or all");
+  }
+
+  bool regressed = false;
+  for (auto scale : scales) {
+    for (const auto& result : run_scale(*scale, virality, seed, std::chrono::duration<double>(min_time))) {
+      std::cout << tp::benchmark::to_json(result) << std::endl;
+
+      auto slowdown = tp::benchmark::slowdown(result, baseline);
+      if (slowdown && slowdown.value() > 1 + tolerance / 100) {
+        fprintf(stderr, "regression: %s on %s is %.1f%% slower than the baseline\n",
+                result.benchmark.c_str(), result.scale.c_str(), (slowdown.value() - 1) * 100);
+        regressed = true;
+      }
+    }
+  }
+
+  return regressed ? 2 : 0;
+}
@@ -0,0 +1,172 @@
+#include <benchmark.hpp>
+#include <population.hpp>
+
+#include <algorithm>
+#include <cerrno>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <optional>
+#include <random>
+#include <string>
+#include <variant>
+#include <vector>
+
+namespace tp {
+
+// string or number value of key in a line written by to_json
+static
+std::optional<std::string> json_value(const std::string& line, const std::string& key) {
+  auto found = line.find("\"" + key + "\":");
+  if (found == std::string::npos) {
+    return {};
+  }
+
+  auto start = found + key.size() + 3;
+  if (start < line.size() && line[start] == '"') {
+    auto end = line.find('"', start + 1);
+    if (end == std::string::npos) {
+      return {};
+    }
+
+    return line.substr(start + 1, end - start - 1);
+  }
+
+  auto end = line.find_first_of(",}", start);
+  if (end == std::string::npos) {
+    return {};
+  }
+
+  return line.substr(start, end - start);
+}
+
+const std::vector<type::bench_scale>& benchmark::scales() {
+  static const std::vector<type::bench_scale> scales{
+    {"small", 200, 600, 20},
+    {"medium", 1000, 3000, 30},
+    {"large", 5000, 20000, 30},
+  };
+
+  return scales;
+}
+
+population benchmark::generate(const type::bench_scale& scale, std::mt19937& generator) {
+  population pop(scale.persons);
+  std::uniform_int_distribution<type::person> person(0, scale.persons - 1);
+
+  while (pop.relations().size() < scale.relations) {
+    pop.add_relation({person(generator), person(generator)});
+  }
+
+  std::vector<type::person> persons(scale.persons);
+  for (type::person i = 0; i < scale.persons; i++) {
+    persons[i] = i;
+  }
+
+  std::shuffle(persons.begin(), persons.end(), generator);
+  persons.resize(scale.persons * scale.infected_percent / 100);
+  for (auto i : persons) {
+    pop.add_infected(i);
+  }
+
+  return pop;
+}
+
+std::optional<std::string> benchmark::write(const population& pop, const std::filesystem::path& path) {
+  std::ofstream file(path, std::ofstream::out | std::ofstream::trunc);
+  if (file.fail()) {
+    return strerror(errno);
+  }
+
+  file << pop.size() << " " << pop.infected().size() << "\n";
+  for (type::person i = 0; i < pop.size(); i++) {
+    auto adjacents = pop.relations(i);
+    for (type::person j = 0; j < pop.size(); j++) {
+      file << (adjacents != nullptr && adjacents->contains(j) ? 1 : 0) << " ";
+    }
+    file << "\n";
+  }
+
+  for (auto i : pop.infected()) {
+    file << i << "\n";
+  }
+
+  if (file.fail()) {
+    return strerror(errno);
+  }
+
+  return {};
+}
+
+std::string benchmark::to_json(const type::bench_result& result) {
+  char line[512];
+  snprintf(line, sizeof(line),
+           "{\"benchmark\":\"%s\",\"scale\":\"%s\",\"ops\":%llu,\"ns_per_op\":%.1f,"
+           "\"evaluations_per_second\":%.1f,\"allocations_per_op\":%.2f}",
+           result.benchmark.c_str(), result.scale.c_str(), (unsigned long long) result.ops,
+           result.ns_per_op, result.evaluations_per_second, result.allocations_per_op);
+  return line;
+}
+
+std::optional<type::bench_result> benchmark::from_json(const std::string& line) {
+  auto name = json_value(line, "benchmark");
+  auto scale = json_value(line, "scale");
+  auto ops = json_value(line, "ops");
+  auto ns_per_op = json_value(line, "ns_per_op");
+  auto evaluations_per_second = json_value(line, "evaluations_per_second");
+  auto allocations_per_op = json_value(line, "allocations_per_op");
+
+  if (!name || !scale || !ops || !ns_per_op || !evaluations_per_second || !allocations_per_op) {
+    return {};
+  }
+
+  return type::bench_result{
+    name.value(),
+    scale.value(),
+    std::strtoull(ops->c_str(), nullptr, 10),
+    std::strtod(ns_per_op->c_str(), nullptr),
+    std::strtod(evaluations_per_second->c_str(), nullptr),
+    std::strtod(allocations_per_op->c_str(), nullptr),
+  };
+}
+
+std::variant<std::vector<type::bench_result>, std::string> benchmark::load_baseline(const std::filesystem::path& path) {
+  std::ifstream file(path, std::ifstream::in);
+  if (file.fail()) {
+    return strerror(errno);
+  }
+
+  std::vector<type::bench_result> results;
+  std::string line;
+  for (unsigned int number = 1; std::getline(file, line); number++) {
+    if (line.empty()) {
+      continue;
+    }
+
+    auto result = from_json(line);
+    if (!result) {
+      return "line " + std::to_string(number) + ": expected a benchmark result";
+    }
+
+    results.push_back(result.value());
+  }
+
+  return results;
+}
+
+std::optional<double> benchmark::slowdown(const type::bench_result& result,
+                                          const std::vector<type::bench_result>& baseline) {
+  auto found = std::find_if(baseline.begin(), baseline.end(), [&] (const auto& previous) {
+    return previous.benchmark == result.benchmark && previous.scale == result.scale;
+  });
+
+  if (found == baseline.end() || found->ns_per_op <= 0) {
+    return {};
+  }
+
+  return result.ns_per_op / found->ns_per_op;
+}
+
+} /* namespace tp */
@@ -1,11 +1,15 @@
 #include <algorithm_basic.hpp>
 #include <chromosome.hpp>
+#include <contagion.hpp>
 #include <population.hpp>
+#include <relation_set.hpp>
 #include <settings.hpp>
 
 #include <algorithm>
+#include <iterator>
 #include <optional>
 #include <iostream>
+#include <vector>
 
 namespace tp {
 
@@ -16,8 +20,7 @@ chromosome::chromosome(settings& settings, const population& pop)
   std::vector<type::relation> relations_vec(relations.begin(), relations.end());
 
   algorithm_basic algorithm_basic(settings_, population_);
-  auto solutions = algorithm_basic.isolate_50_percent();
-  isolations_.insert(solutions.begin(), solutions.end());
+  isolations_ = relation_set(algorithm_basic.isolate_50_percent());
 
   //int isolation_count = isolations_.size() + 50;
   //while (isolations_.size() < isolation_count) {
@@ -28,36 +31,46 @@ chromosome::chromosome(settings& settings, const population& pop)
 chromosome::chromosome(settings& settings, const population& pop, const type::relations& isolations)
   : settings_(settings), population_(pop), isolations_(isolations) {}
 
-const type::relations& chromosome::isolations() const {
+chromosome::chromosome(settings& settings, const population& pop, const relation_set& isolations)
+  : settings_(settings), population_(pop), isolations_(isolations) {}
+
+const relation_set& chromosome::isolations() const {
   return isolations_;
 }
 
 std::pair<chromosome*, chromosome*> chromosome::cross(const chromosome* other) const {
-  std::vector<type::relation> combined;
-  combined.insert(combined.end(), isolations_.begin(), isolations_.end());
-  combined.insert(combined.end(), other->isolations_.begin(), other->isolations_.end());
-
-  chromosome* child1 = new chromosome(settings_, population_, type::relations{});
-  chromosome* child2 = new chromosome(settings_, population_, type::relations{});
-
-  for (const auto& isolation : combined) {
-    if (child1->isolations_.contains(isolation)) {
-       child2->isolations_.insert(isolation);
-       continue;
-    }
-
-    if (child2->isolations_.contains(isolation)) {
-       child1->isolations_.insert(isolation);
-       continue;
+  // relations of both parents go to both children, the others to either one
+  std::vector<type::relation> own1;
+  std::vector<type::relation> own2;
+  for (const auto& isolation : isolations_) {
+    if (settings_.binary_random()) {
+      own1.push_back(isolation);
+    } else {
+      own2.push_back(isolation);
     }
+  }
 
-    if (settings_.binary_random()) {
-      child1->isolations_.insert(isolation);
+  std::vector<type::relation> other1;
+  std::vector<type::relation> other2;
+  for (const auto& isolation : other->isolations_) {
+    if (std::binary_search(own1.begin(), own1.end(), isolation)) {
+      other2.push_back(isolation);
+    } else if (std::binary_search(own2.begin(), own2.end(), isolation)) {
+      other1.push_back(isolation);
+    } else if (settings_.binary_random()) {
+      other1.push_back(isolation);
     } else {
-      child2->isolations_.insert(isolation);
+      other2.push_back(isolation);
     }
   }
 
+  std::vector<type::relation> merged1;
+  std::vector<type::relation> merged2;
+  std::merge(own1.begin(), own1.end(), other1.begin(), other1.end(), std::back_inserter(merged1));
+  std::merge(own2.begin(), own2.end(), other2.begin(), other2.end(), std::back_inserter(merged2));
+
+  chromosome* child1 = new chromosome(settings_, population_, relation_set::from_sorted(merged1));
+  chromosome* child2 = new chromosome(settings_, population_, relation_set::from_sorted(merged2));
   return {child1, child2};
 }
 
@@ -76,11 +89,21 @@ chromosome* chromosome::mutate(unsigned int add, unsigned int remove, unsigned i
     mutation->update_isolation();
   }
 
+  // isolating more relations can only shrink the infection and isolating
+  // fewer can only grow it, so one-sided mutations inherit the parent's verdict
+  if (validity_ == validity::valid && remove == 0 && update == 0) {
+    mutation->validity_ = validity::valid;
+    mutation->inferred_ = true;
+  } else if (validity_ == validity::invalid && add == 0 && update == 0) {
+    mutation->validity_ = validity::invalid;
+    mutation->inferred_ = true;
+  }
+
   return mutation;
 }
 
 std::optional<unsigned int> chromosome::cost() {
-  float infected_percent = population_.run(settings_.virality(), isolations_);
+  float infected_percent = population_.run(settings_.virality(), isolations_.relations());
   if (infected_percent > 50) {
     return {};
   }
@@ -88,31 +111,109 @@ std::optional<unsigned int> chromosome::cost() {
   return isolations_.size();
 }
 
-void chromosome::add_isolation() {
+std::optional<unsigned int> chromosome::cost(const contagion& contagion, bool parallel) {
+  return evaluate(contagion, parallel).cost;
+}
+
+type::evaluation chromosome::evaluate(const contagion& contagion, bool parallel) {
+  if (validity_ != validity::unknown) {
+    auto screening = inferred_ ? type::screening::inferred : type::screening::cached;
+    inferred_ = false;
+
+    if (validity_ == validity::invalid) {
+      return {{}, screening};
+    }
+
+    return {isolations_.size(), screening};
+  }
+
+  // more than half of the population infected is infeasible, the simulation
+  // stops as soon as that many are reached
+  auto isolated = contagion.isolated(isolations_);
+  if (contagion.exceeds(settings_.virality(), isolated, contagion.size() / 2, parallel)) {
+    validity_ = validity::invalid;
+    return {{}, type::screening::aborted};
+  }
+
+  validity_ = validity::valid;
+  return {isolations_.size(), type::screening::simulated};
+}
+
+type::move chromosome::add_isolation() {
   auto& r = population_.relations();
-  auto& i = isolations_;
+  if (isolations_.size() >= r.size()) {
+    return {};
+  }
 
-  std::vector<type::relation> available;
-  set_difference(r.begin(), r.end(), i.begin(), i.end(), std::inserter(available, available.begin()));
+  // drawing among all the relations until one is not isolated yet costs a
+  // few draws while most relations are free, only a nearly full chromosome
+  // falls back to listing the free ones
+  std::optional<type::relation> added;
+  for (unsigned int attempt = 0; attempt < k_add_attempts && !added; attempt++) {
+    const auto& drawn = population_.relation(settings_.random_to(r.size() - 1));
+    if (!isolations_.contains(drawn)) {
+      added = drawn;
+    }
+  }
 
-  if (available.size() != 0) {
-    isolations_.insert(settings_.random_from(available));
+  if (!added) {
+    std::vector<type::relation> available;
+    std::set_difference(r.begin(), r.end(), isolations_.begin(), isolations_.end(), std::back_inserter(available));
+    added = settings_.random_from(available);
   }
+
+  isolations_.insert(added.value());
+  validity_ = validity::unknown;
+  return {added, {}};
 }
 
-void chromosome::remove_isolation() {
+type::move chromosome::remove_isolation() {
   if (isolations_.size() <= 1) {
-    return;
+    return {};
   }
 
-  auto it = isolations_.begin();
-  std::advance(it, settings_.random_to(isolations_.size() - 1));
-  isolations_.erase(it);
+  auto removed = isolations_.nth(settings_.random_to(isolations_.size() - 1));
+  isolations_.erase(removed);
+  validity_ = validity::unknown;
+  return {{}, removed};
+}
+
+type::move chromosome::update_isolation() {
+  auto removed = remove_isolation();
+  auto added = add_isolation();
+  return {added.added, removed.removed};
+}
+
+void chromosome::apply(const type::move& move) {
+  validity_ = validity::unknown;
+
+  if (move.removed) {
+    isolations_.erase(*move.removed);
+  }
+
+  if (move.added) {
+    isolations_.insert(*move.added);
+  }
+}
+
+void chromosome::undo(const type::move& move) {
+  validity_ = validity::unknown;
+
+  if (move.added) {
+    isolations_.erase(*move.added);
+  }
+
+  if (move.removed) {
+    isolations_.insert(*move.removed);
+  }
+}
+
+unsigned long chromosome::serial() const {
+  return serial_;
 }
 
-void chromosome::update_isolation() {
-  remove_isolation();
-  add_isolation();
+void chromosome::set_serial(unsigned long serial) {
+  serial_ = serial;
 }
 
 } /* namespace tp */
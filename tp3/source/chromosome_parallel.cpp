@@ -1,13 +1,13 @@
+#include <algorithm_basic.hpp>
 #include <chromosome.hpp>
 #include <chromosome_parallel.hpp>
+#include <trace.hpp>
 #include <tbb/blocked_range.h>
-#include <tbb/concurrent_unordered_map.h>
-#include <tbb/concurrent_unordered_set.h>
-#include <tbb/concurrent_vector.h>
 #include <tbb/parallel_for.h>
 
 #include <algorithm>
 #include <map>
+#include <optional>
 #include <set>
 #include <vector>
 
@@ -15,85 +15,77 @@
 
 namespace tp::parallel {
 
-void chromosome_costs::operator()(std::vector<chromosome*>& chromosomes, unsigned int max) {
-  tbb::concurrent_unordered_multimap<unsigned int, chromosome*> concurrent_costs;
-  tbb::concurrent_unordered_set<chromosome*> concurrent_invalids;
+chromosome_costs::chromosome_costs(const contagion& contagion)
+  : contagion_(contagion) {}
 
-  tbb::parallel_for(
-    tbb::blocked_range<std::vector<chromosome*>::iterator>(
-      chromosomes.begin(),
-      chromosomes.end()
-    ),
-    [&] (auto range) {
-      std::for_each(
-        range.begin(),
-        range.end(),
-        [&] (auto chromosome) {
-          auto cost = chromosome->cost();
-          if (cost) {
-            concurrent_costs.emplace(cost.value(), chromosome);
-          } else {
-            concurrent_costs.emplace(max, chromosome);
-            concurrent_invalids.insert(chromosome);
-          }
-        }
-      );
-    }
-  );
+void chromosome_costs::operator()(std::vector<chromosome*>& chromosomes, unsigned int max) {
+  std::vector<std::optional<unsigned int>> costs(chromosomes.size());
 
-  std::for_each(
-    concurrent_costs.begin(),
-    concurrent_costs.end(),
-    [&] (auto result) {
-      costs_.emplace(result);
+  // a generation is too small to balance huge simulations across threads, so
+  // those are parallelized within each simulation instead
+  if (contagion_.relation_count() >= k_parallel_relations) {
+    for (std::size_t i = 0; i < chromosomes.size(); i++) {
+      costs[i] = evaluate(chromosomes[i], true);
     }
-  );
-
-  std::for_each(
-    concurrent_invalids.begin(),
-    concurrent_invalids.end(),
-    [&] (auto result) {
-      invalids_.emplace(result);
+  } else {
+    tbb::parallel_for(
+      tbb::blocked_range<std::size_t>(0, chromosomes.size()),
+      [&] (auto range) {
+        for (auto i = range.begin(); i != range.end(); i++) {
+          costs[i] = evaluate(chromosomes[i], false);
+        }
+      }
+    );
+  }
+
+  // filled in the order of the chromosomes, so that equal costs keep it
+  for (std::size_t i = 0; i < chromosomes.size(); i++) {
+    if (costs[i]) {
+      costs_.emplace(costs[i].value(), chromosomes[i]);
+    } else {
+      costs_.emplace(max, chromosomes[i]);
+      invalids_.insert(chromosomes[i]);
     }
-  );
+  }
 }
 
 const std::multimap<unsigned int, chromosome*>& chromosome_costs::costs() const {
   return costs_;
 }
 
-const std::set<chromosome*> chromosome_costs::invalids() const {
+const type::chromosomes& chromosome_costs::invalids() const {
   return invalids_;
 }
 
+unsigned int chromosome_costs::screened(type::screening screening) const {
+  return screened_[static_cast<std::size_t>(screening)];
+}
+
+std::optional<unsigned int> chromosome_costs::evaluate(chromosome* evaluated, bool parallel) {
+  trace::span span("evaluate");
+  auto [cost, stage] = evaluated->evaluate(contagion_, parallel);
+  screened_[static_cast<std::size_t>(stage)]++;
+  return cost;
+}
+
+chromosome_cross::chromosome_cross(settings& settings)
+  : settings_(settings) {}
+
 void chromosome_cross::operator()(std::vector<cross_settings>& settings) {
-  tbb::concurrent_vector<chromosome*> concurrent_created;
+  unsigned int batch = settings_.next_batch();
+  created_.assign(settings.size() * 2, nullptr);
 
   tbb::parallel_for(
-    tbb::blocked_range<std::vector<cross_settings>::iterator>(
-      settings.begin(),
-      settings.end()
-    ),
+    tbb::blocked_range<std::size_t>(0, settings.size()),
     [&] (auto range) {
-      std::for_each(
-        range.begin(),
-        range.end(),
-        [&] (auto settings) {
-          chromosome* c1 = std::get<0>(settings);
-          chromosome* c2 = std::get<1>(settings);
-          auto [n1, n2] = c1->cross(c2);
-          concurrent_created.push_back(n1);
-          concurrent_created.push_back(n2);
-        }
-      );
-    }
-  );
-
-  std::for_each(
-    concurrent_created.begin(),
-    concurrent_created.end(),
-    [&] (auto result) {
-      created_.push_back(result);
+      for (auto i = range.begin(); i != range.end(); i++) {
+        trace::span span("cross");
+        tp::settings::stream stream(settings_, batch, i);
+        auto [c1, c2] = settings[i];
+        auto [n1, n2] = c1->cross(c2);
+        created_[2 * i] = n1;
+        created_[2 * i + 1] = n2;
+      }
     }
   );
 }
@@ -102,39 +94,76 @@ const std::vector<chromosome*>& chromosome_cross::created() const {
   return created_;
 }
 
+chromosome_mutate::chromosome_mutate(settings& settings)
+  : settings_(settings) {}
+
 void chromosome_mutate::operator()(std::vector<mutation_settings>& settings) {
-  tbb::concurrent_vector<chromosome*> concurrent_created;
+  unsigned int batch = settings_.next_batch();
+  created_.assign(settings.size(), nullptr);
 
   tbb::parallel_for(
-    tbb::blocked_range<std::vector<mutation_settings>::iterator>(
-      settings.begin(),
-      settings.end()
-    ),
+    tbb::blocked_range<std::size_t>(0, settings.size()),
     [&] (auto range) {
-      std::for_each(
-        range.begin(),
-        range.end(),
-        [&] (auto settings) {
-          chromosome* chromosome = std::get<0>(settings);
-          unsigned int add = std::get<1>(settings);
-          unsigned int remove = std::get<2>(settings);
-          unsigned int update = std::get<3>(settings);
-          concurrent_created.push_back(chromosome->mutate(add, remove, update));
-        }
-      );
+      for (auto i = range.begin(); i != range.end(); i++) {
+        trace::span span("mutate");
+        tp::settings::stream stream(settings_, batch, i);
+        auto [chromosome, add, remove, update] = settings[i];
+        created_[i] = chromosome->mutate(add, remove, update);
+      }
     }
   );
+}
+
+const std::vector<chromosome*>& chromosome_mutate::created() const {
+  return created_;
+}
+
+chromosome_seed::chromosome_seed(settings& settings, const population& pop)
+  : settings_(settings), population_(pop) {}
+
+void chromosome_seed::operator()(std::vector<seed_settings>& settings) {
+  algorithm_basic algorithm_basic(settings_, population_);
+
+  bool needs_infected = std::any_of(settings.begin(), settings.end(), [] (const auto& settings) {
+    return !std::get<0>(settings);
+  });
 
-  std::for_each(
-    concurrent_created.begin(),
-    concurrent_created.end(),
-    [&] (auto result) {
-      created_.push_back(result);
+  type::relations isolate_infected;
+  if (needs_infected) {
+    isolate_infected = algorithm_basic.isolate_infected();
+  }
+
+  unsigned int batch = settings_.next_batch();
+  created_.assign(settings.size(), nullptr);
+
+  tbb::parallel_for(
+    tbb::blocked_range<std::size_t>(0, settings.size()),
+    [&] (auto range) {
+      for (auto i = range.begin(); i != range.end(); i++) {
+        trace::span span("seed");
+        tp::settings::stream stream(settings_, batch, i);
+        auto [root, add, remove] = settings[i];
+
+        chromosome* seed;
+        if (root) {
+          seed = new chromosome(settings_, population_, algorithm_basic.isolate_50_percent(root.value()));
+        } else {
+          seed = new chromosome(settings_, population_, isolate_infected);
+        }
+
+        if (add != 0 || remove != 0) {
+          chromosome* perturbed = seed->mutate(add, remove, 0);
+          delete seed;
+          seed = perturbed;
+        }
+
+        created_[i] = seed;
+      }
     }
   );
 }
 
-const std::vector<chromosome*>& chromosome_mutate::created() const {
+const std::vector<chromosome*>& chromosome_seed::created() const {
   return created_;
 }
 
@@ -0,0 +1,458 @@
+#include <contagion.hpp>
+#include <memory.hpp>
+#include <relation_set.hpp>
+
+#include <tbb/blocked_range.h>
+#include <tbb/enumerable_thread_specific.h>
+#include <tbb/parallel_for.h>
+
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <cstdint>
+#include <limits>
+#include <optional>
+#include <vector>
+
+namespace tp {
+
+contagion::contagion(const population& pop, backend backend)
+  : size_(pop.size()), span_(span(pop)), initial_count_(pop.infected().size()),
+    relations_(pop.relations().begin(), pop.relations().end()), words_(0) {
+
+  offsets_.assign(span_ + 1, 0);
+  for (const auto& [i, j] : relations_) {
+    offsets_[i + 1]++;
+    offsets_[j + 1]++;
+  }
+
+  for (type::person i = 0; i < span_; i++) {
+    offsets_[i + 1] += offsets_[i];
+  }
+
+  std::vector<unsigned int> next(offsets_.begin(), offsets_.end() - 1);
+  adjacents_.resize(2 * relations_.size());
+  for (type::relation_id id = 0; id < relations_.size(); id++) {
+    auto [i, j] = relations_[id];
+    adjacents_[next[i]++] = {j, id};
+    adjacents_[next[j]++] = {i, id};
+  }
+
+  infected_.assign(span_, false);
+  initial_.reserve(initial_count_);
+  for (auto i : pop.infected()) {
+    infected_[i] = true;
+    initial_.push_back(i);
+  }
+
+  if (dense(size_, relations_.size(), backend)) {
+    words_ = (span_ + 63) / 64;
+    matrix_.assign(((std::size_t) size_) * words_, 0);
+    for (const auto& [i, j] : relations_) {
+      if (i < size_) {
+        matrix_[((std::size_t) i) * words_ + j / 64] |= std::uint64_t(1) << (j % 64);
+      }
+
+      if (j < size_) {
+        matrix_[((std::size_t) j) * words_ + i / 64] |= std::uint64_t(1) << (i % 64);
+      }
+    }
+  }
+}
+
+// persons past the size may still appear in relations or as infected
+unsigned int contagion::span(const population& pop) {
+  unsigned int span = pop.size();
+  for (const auto& relation : pop.relations()) {
+    span = std::max(span, relation.second + 1);
+  }
+
+  if (!pop.infected().empty()) {
+    span = std::max(span, *pop.infected().rbegin() + 1);
+  }
+
+  return span;
+}
+
+bool contagion::dense(unsigned int size, std::size_t relation_count, backend backend) {
+  if (backend != backend::automatic) {
+    return backend == backend::dense;
+  }
+
+  float pairs = ((float) size) * ((float) size - 1) / 2;
+  return size <= k_dense_max_size && pairs > 0 && relation_count / pairs >= k_dense_density;
+}
+
+unsigned int contagion::size() const {
+  return size_;
+}
+
+unsigned int contagion::relation_count() const {
+  return relations_.size();
+}
+
+std::optional<type::relation_id> contagion::relation_id(const type::relation& relation) const {
+  auto it = std::lower_bound(relations_.begin(), relations_.end(), relation);
+  if (it == relations_.end() || *it != relation) {
+    return {};
+  }
+
+  return it - relations_.begin();
+}
+
+const type::relation& contagion::relation(type::relation_id id) const {
+  return relations_[id];
+}
+
+const type::adjacent* contagion::adjacents_begin(type::person i) const {
+  return adjacents_.data() + offsets_[i];
+}
+
+const type::adjacent* contagion::adjacents_end(type::person i) const {
+  return adjacents_.data() + offsets_[i + 1];
+}
+
+bool contagion::infected(type::person i) const {
+  return i < span_ && infected_[i];
+}
+
+std::size_t contagion::footprint() const {
+  return memory::vector(relations_) + memory::vector(offsets_) + memory::vector(adjacents_)
+    + memory::vector(initial_) + memory::vector(infected_) + memory::vector(matrix_);
+}
+
+// footprint of the contagion of pop, without building it
+std::size_t contagion::footprint(const population& pop, backend backend) {
+  std::size_t span = contagion::span(pop);
+  std::size_t relations = pop.relations().size();
+  std::size_t words = (span + 63) / 64;
+
+  std::size_t bytes = relations * sizeof(type::relation) + (span + 1) * sizeof(unsigned int)
+    + 2 * relations * sizeof(type::adjacent) + pop.infected().size() * sizeof(type::person)
+    + words * sizeof(std::uint64_t);
+
+  if (dense(pop.size(), relations, backend)) {
+    bytes += ((std::size_t) pop.size()) * words * sizeof(std::uint64_t);
+  }
+
+  return bytes;
+}
+
+bool contagion::dense() const {
+  return words_ != 0;
+}
+
+std::vector<bool> contagion::isolated(const type::relations& isolations) const {
+  return isolated_sorted(isolations);
+}
+
+std::vector<bool> contagion::isolated(const relation_set& isolations) const {
+  return isolated_sorted(isolations);
+}
+
+template <typename Relations>
+std::vector<bool> contagion::isolated_sorted(const Relations& isolations) const {
+  std::vector<bool> isolated(relations_.size(), false);
+
+  auto it = relations_.begin();
+  for (const auto& isolation : isolations) {
+    it = std::lower_bound(it, relations_.end(), isolation);
+    if (it == relations_.end()) {
+      break;
+    }
+
+    if (*it == isolation) {
+      isolated[it - relations_.begin()] = true;
+    }
+  }
+
+  return isolated;
+}
+
+unsigned int contagion::run(unsigned int virality, const type::relations& isolations) const {
+  return run(virality, isolated(isolations));
+}
+
+unsigned int contagion::run(unsigned int virality, const std::vector<bool>& isolated,
+                            std::vector<unsigned int>* rounds) const {
+  if (dense()) {
+    return run_dense(virality, isolated, rounds, k_unlimited);
+  }
+
+  return run_sparse(virality, isolated, rounds, k_unlimited);
+}
+
+unsigned int contagion::run_parallel(unsigned int virality, const std::vector<bool>& isolated,
+                                     std::vector<unsigned int>* rounds) const {
+  if (dense()) {
+    return run_dense(virality, isolated, rounds, k_unlimited);
+  }
+
+  return run_sparse_parallel(virality, isolated, rounds, k_unlimited);
+}
+
+bool contagion::exceeds(unsigned int virality, const std::vector<bool>& isolated,
+                        unsigned int limit, bool parallel) const {
+  if (dense()) {
+    return run_dense(virality, isolated, nullptr, limit) > limit;
+  }
+
+  if (parallel) {
+    return run_sparse_parallel(virality, isolated, nullptr, limit) > limit;
+  }
+
+  return run_sparse(virality, isolated, nullptr, limit) > limit;
+}
+
+unsigned int contagion::run_sparse(unsigned int virality, const std::vector<bool>& isolated,
+                                   std::vector<unsigned int>* rounds, unsigned int limit) const {
+  std::vector<bool> infected(infected_);
+  std::vector<unsigned int> counts(span_, 0);
+  std::vector<type::person> frontier(initial_);
+  std::vector<type::person> next;
+  unsigned int infected_count = initial_count_;
+  unsigned int threshold = std::max(virality, 1u);
+
+  if (rounds != nullptr) {
+    rounds->assign(span_, std::numeric_limits<unsigned int>::max());
+    for (auto i : initial_) {
+      (*rounds)[i] = 0;
+    }
+  }
+
+  for (unsigned int round = 1; !frontier.empty(); round++) {
+    next.clear();
+
+    for (auto i : frontier) {
+      for (auto it = adjacents_begin(i); it != adjacents_end(i); it++) {
+        auto [j, id] = *it;
+        if (infected[j] || j >= size_) {
+          continue;
+        }
+
+        // with a virality of zero, population::run also infects the persons
+        // whose relation to an initially infected person was isolated
+        if (isolated[id] && (virality != 0 || round != 1)) {
+          continue;
+        }
+
+        if (++counts[j] == threshold) {
+          next.push_back(j);
+          // the threshold is crossed mid-round, the rest of the round cannot
+          // make the outcome feasible again
+          if (rounds == nullptr && infected_count + next.size() > limit) {
+            return infected_count + next.size();
+          }
+        }
+      }
+    }
+
+    for (auto j : next) {
+      infected[j] = true;
+      if (rounds != nullptr) {
+        (*rounds)[j] = round;
+      }
+    }
+
+    infected_count += next.size();
+    if (infected_count > limit) {
+      break;
+    }
+
+    frontier.swap(next);
+  }
+
+  return infected_count;
+}
+
+unsigned int contagion::run_sparse_parallel(unsigned int virality, const std::vector<bool>& isolated,
+                                            std::vector<unsigned int>* rounds, unsigned int limit) const {
+  std::vector<bool> infected(infected_);
+  std::vector<unsigned int> counts(span_, 0);
+  std::vector<type::person> frontier(initial_);
+  tbb::enumerable_thread_specific<std::vector<type::person>> local_next;
+  std::vector<type::person> next;
+  unsigned int infected_count = initial_count_;
+  unsigned int threshold = std::max(virality, 1u);
+
+  if (rounds != nullptr) {
+    rounds->assign(span_, std::numeric_limits<unsigned int>::max());
+    for (auto i : initial_) {
+      (*rounds)[i] = 0;
+    }
+  }
+
+  for (unsigned int round = 1; !frontier.empty(); round++) {
+    auto spread = [&] (type::person i, std::vector<type::person>& reached) {
+      for (auto it = adjacents_begin(i); it != adjacents_end(i); it++) {
+        auto [j, id] = *it;
+        if (infected[j] || j >= size_) {
+          continue;
+        }
+
+        if (isolated[id] && (virality != 0 || round != 1)) {
+          continue;
+        }
+
+        // only the thread bringing the count to the threshold keeps the person
+        if (std::atomic_ref<unsigned int>(counts[j]).fetch_add(1, std::memory_order_relaxed) + 1 == threshold) {
+          reached.push_back(j);
+        }
+      }
+    };
+
+    next.clear();
+    if (frontier.size() < k_parallel_frontier) {
+      for (auto i : frontier) {
+        spread(i, next);
+      }
+    } else {
+      tbb::parallel_for(
+        tbb::blocked_range<std::size_t>(0, frontier.size()),
+        [&] (auto range) {
+          auto& reached = local_next.local();
+          for (auto k = range.begin(); k != range.end(); k++) {
+            spread(frontier[k], reached);
+          }
+        }
+      );
+
+      for (auto& reached : local_next) {
+        next.insert(next.end(), reached.begin(), reached.end());
+        reached.clear();
+      }
+    }
+
+    for (auto j : next) {
+      infected[j] = true;
+      if (rounds != nullptr) {
+        (*rounds)[j] = round;
+      }
+    }
+
+    infected_count += next.size();
+    if (infected_count > limit) {
+      break;
+    }
+
+    frontier.swap(next);
+  }
+
+  return infected_count;
+}
+
+unsigned int contagion::run_dense(unsigned int virality, const std::vector<bool>& isolated,
+                                  std::vector<unsigned int>* rounds, unsigned int limit) const {
+  const unsigned int healthy = std::numeric_limits<unsigned int>::max();
+  std::vector<unsigned int> infected_round(span_, healthy);
+  std::vector<std::uint64_t> infected_mask(words_, 0);
+  std::vector<std::uint64_t> candidates(words_, 0);
+  std::vector<unsigned int> isolated_infected(size_, 0);
+  std::vector<type::person> frontier(initial_);
+  std::vector<type::person> next;
+  unsigned int infected_count = initial_count_;
+  unsigned int threshold = std::max(virality, 1u);
+
+  for (auto i : initial_) {
+    infected_round[i] = 0;
+    infected_mask[i / 64] |= std::uint64_t(1) << (i % 64);
+  }
+
+  std::vector<type::relation> isolations;
+  for (type::relation_id id = 0; id < relations_.size(); id++) {
+    if (isolated[id]) {
+      isolations.push_back(relations_[id]);
+    }
+  }
+
+  // the isolated relations of each person, to take them off the counts of
+  // the bit matrix, which ignores isolations
+  std::vector<unsigned int> isolated_offsets(span_ + 1, 0);
+  for (auto [i, j] : isolations) {
+    isolated_offsets[i + 1]++;
+    isolated_offsets[j + 1]++;
+  }
+
+  for (type::person i = 0; i < span_; i++) {
+    isolated_offsets[i + 1] += isolated_offsets[i];
+  }
+
+  std::vector<type::person> isolated_adjacents(isolated_offsets[span_]);
+  std::vector<unsigned int> filled(isolated_offsets.begin(), isolated_offsets.end() - 1);
+  for (auto [i, j] : isolations) {
+    isolated_adjacents[filled[i]++] = j;
+    isolated_adjacents[filled[j]++] = i;
+  }
+
+  for (unsigned int round = 1; !frontier.empty(); round++) {
+    // only the healthy neighbours of the persons infected last round can see
+    // their count change, so only their rows are counted
+    std::fill(candidates.begin(), candidates.end(), 0);
+    for (auto i : frontier) {
+      if (i < size_) {
+        const std::uint64_t* row = matrix_.data() + ((std::size_t) i) * words_;
+        for (unsigned int w = 0; w < words_; w++) {
+          candidates[w] |= row[w];
+        }
+      } else {
+        for (auto it = adjacents_begin(i); it != adjacents_end(i); it++) {
+          candidates[it->first / 64] |= std::uint64_t(1) << (it->first % 64);
+        }
+      }
+
+      for (auto k = isolated_offsets[i]; k < isolated_offsets[i + 1]; k++) {
+        if (isolated_adjacents[k] < size_) {
+          isolated_infected[isolated_adjacents[k]]++;
+        }
+      }
+    }
+
+    next.clear();
+    for (unsigned int candidate_word = 0; candidate_word < words_; candidate_word++) {
+      for (auto bits = candidates[candidate_word] & ~infected_mask[candidate_word]; bits != 0; bits &= bits - 1) {
+        type::person j = candidate_word * 64 + std::countr_zero(bits);
+        if (j >= size_) {
+          continue;
+        }
+
+        const std::uint64_t* row = matrix_.data() + ((std::size_t) j) * words_;
+        unsigned int count = 0;
+        for (unsigned int w = 0; w < words_; w++) {
+          count += std::popcount(row[w] & infected_mask[w]);
+        }
+
+        if (virality != 0 || round != 1) {
+          count -= isolated_infected[j];
+        }
+
+        if (count >= threshold) {
+          next.push_back(j);
+        }
+      }
+    }
+
+    for (auto j : next) {
+      infected_round[j] = round;
+      infected_mask[j / 64] |= std::uint64_t(1) << (j % 64);
+    }
+
+    infected_count += next.size();
+    if (infected_count > limit) {
+      break;
+    }
+
+    frontier.swap(next);
+  }
+
+  if (rounds != nullptr) {
+    rounds->swap(infected_round);
+  }
+
+  return infected_count;
+}
+
+float contagion::percent(unsigned int infected) const {
+  return 100 * (((float) infected) / ((float) size_));
+}
+
+} /* namespace tp */
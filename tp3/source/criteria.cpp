@@ -0,0 +1,85 @@
+#include <criteria.hpp>
+
+#include <chrono>
+#include <optional>
+
+namespace tp {
+
+criteria::criteria()
+  : generation_(0), stagnant_generations_(0),
+    start_time_(std::chrono::steady_clock::now()) {}
+
+void criteria::set_time_limit(std::chrono::milliseconds limit) {
+  time_limit_ = limit;
+}
+
+void criteria::set_max_generations(unsigned int generations) {
+  max_generations_ = generations;
+}
+
+void criteria::set_target_cost(unsigned int cost) {
+  target_cost_ = cost;
+}
+
+void criteria::set_stagnation(unsigned int generations) {
+  stagnation_ = generations;
+}
+
+void criteria::set_lower_bound(unsigned int bound) {
+  lower_bound_ = bound;
+}
+
+void criteria::start() {
+  generation_ = 0;
+  stagnant_generations_ = 0;
+  start_time_ = std::chrono::steady_clock::now();
+}
+
+void criteria::next_generation(bool improved) {
+  generation_++;
+
+  if (improved) {
+    stagnant_generations_ = 0;
+  } else {
+    stagnant_generations_++;
+  }
+}
+
+bool criteria::done(std::optional<unsigned int> best_cost) const {
+  if (max_generations_ && generation_ >= max_generations_.value()) {
+    return true;
+  }
+
+  if (time_limit_ && elapsed() >= time_limit_.value()) {
+    return true;
+  }
+
+  if (target_cost_ && best_cost && best_cost.value() <= target_cost_.value()) {
+    return true;
+  }
+
+  if (lower_bound_ && best_cost && best_cost.value() <= lower_bound_.value()) {
+    return true;
+  }
+
+  if (stagnation_ && stagnant_generations_ >= stagnation_.value()) {
+    return true;
+  }
+
+  return false;
+}
+
+std::optional<unsigned int> criteria::lower_bound() const {
+  return lower_bound_;
+}
+
+unsigned int criteria::generation() const {
+  return generation_;
+}
+
+std::chrono::milliseconds criteria::elapsed() const {
+  auto elapsed = std::chrono::steady_clock::now() - start_time_;
+  return std::chrono::duration_cast<std::chrono::milliseconds>(elapsed);
+}
+
+} /* namespace tp */
@@ -0,0 +1,279 @@
+#include <contagion.hpp>
+#include <differential.hpp>
+#include <population.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <optional>
+#include <ostream>
+#include <random>
+#include <sstream>
+#include <string>
+#include <tuple>
+#include <vector>
+
+namespace tp {
+
+// new infections of each round, the initially infected persons excluded
+static
+std::vector<unsigned int> round_sizes(const std::vector<unsigned int>& rounds) {
+  std::vector<unsigned int> sizes;
+
+  for (auto round : rounds) {
+    if (round == 0 || round == std::numeric_limits<unsigned int>::max()) {
+      continue;
+    }
+
+    if (sizes.size() < round) {
+      sizes.resize(round, 0);
+    }
+
+    sizes[round - 1]++;
+  }
+
+  return sizes;
+}
+
+static
+std::string describe(const std::vector<unsigned int>& sizes) {
+  std::ostringstream output;
+  output << "[";
+  for (std::size_t i = 0; i < sizes.size(); i++) {
+    output << (i == 0 ? "" : " ") << sizes[i];
+  }
+  output << "]";
+  return output.str();
+}
+
+type::simulation_case differential::random_case(std::mt19937& generator, unsigned int max_size) {
+  type::simulation_case simulation;
+  simulation.size = std::uniform_int_distribution<unsigned int>(1, std::max(max_size, 1u))(generator);
+  simulation.virality = std::uniform_int_distribution<unsigned int>(0, k_max_virality)(generator);
+
+  std::uniform_int_distribution<unsigned int> person(0, simulation.size - 1);
+
+  auto infected = std::uniform_int_distribution<unsigned int>(0, simulation.size)(generator);
+  for (unsigned int i = 0; i < infected; i++) {
+    simulation.infected.insert(person(generator));
+  }
+
+  // from sparse graphs to ones dense enough for the bitset backend
+  std::size_t pairs = ((std::size_t) simulation.size) * (simulation.size - 1) / 2;
+  std::size_t max_relations = std::min<std::size_t>(pairs, ((std::size_t) simulation.size) * 16);
+  auto relations = std::uniform_int_distribution<std::size_t>(0, max_relations)(generator);
+  for (std::size_t i = 0; i < relations; i++) {
+    auto a = person(generator), b = person(generator);
+    if (a != b) {
+      simulation.relations.insert({std::min(a, b), std::max(a, b)});
+    }
+  }
+
+  std::bernoulli_distribution isolated(std::uniform_real_distribution<double>(0, 1)(generator));
+  for (const auto& relation : simulation.relations) {
+    if (isolated(generator)) {
+      simulation.isolations.insert(relation);
+    }
+  }
+
+  return simulation;
+}
+
+type::simulation_case differential::from_bytes(const std::uint8_t* data, std::size_t size) {
+  std::size_t offset = 0;
+  auto next = [&] () -> unsigned int {
+    return offset < size ? data[offset++] : 0;
+  };
+
+  type::simulation_case simulation;
+  simulation.size = 1 + next() % 64;
+  simulation.virality = next() % (k_max_virality + 1);
+
+  auto infected = next() % (simulation.size + 1);
+  for (unsigned int i = 0; i < infected; i++) {
+    simulation.infected.insert(next() % simulation.size);
+  }
+
+  while (offset < size) {
+    auto a = next() % simulation.size;
+    auto b = next() % simulation.size;
+    bool isolated = next() & 1;
+    if (a == b) {
+      continue;
+    }
+
+    type::relation relation{std::min(a, b), std::max(a, b)};
+    simulation.relations.insert(relation);
+    if (isolated) {
+      simulation.isolations.insert(relation);
+    }
+  }
+
+  return simulation;
+}
+
+population differential::make_population(const type::simulation_case& simulation) {
+  population pop(simulation.size);
+
+  for (auto i : simulation.infected) {
+    pop.add_infected(i);
+  }
+
+  for (const auto& relation : simulation.relations) {
+    pop.add_relation(relation);
+  }
+
+  return pop;
+}
+
+std::optional<std::string> differential::check(const type::simulation_case& simulation) {
+  population pop = make_population(simulation);
+
+  population reference(pop);
+  for (const auto& isolation : simulation.isolations) {
+    reference.remove_relation(isolation);
+  }
+
+  std::vector<unsigned int> expected_rounds;
+  for (unsigned int infected; (infected = reference.run_iteration(simulation.virality)) != 0;) {
+    expected_rounds.push_back(infected);
+  }
+
+  float expected = pop.run(simulation.virality, simulation.isolations);
+  bool expected_exceeds = expected > 50;
+
+  contagion sparse(pop, contagion::backend::sparse);
+  contagion dense(pop, contagion::backend::dense);
+  auto isolated = sparse.isolated(simulation.isolations);
+  auto limit = simulation.size / 2;
+
+  struct outcome {
+    const char* backend;
+    const contagion& model;
+    unsigned int infected;
+    std::vector<unsigned int> rounds;
+    bool exceeds;
+  };
+
+  std::vector<outcome> outcomes;
+  for (auto [name, backend, parallel] : {
+    std::tuple{"sparse", &sparse, false},
+    std::tuple{"parallel", &sparse, true},
+    std::tuple{"dense", &dense, false},
+  }) {
+    std::vector<unsigned int> rounds;
+    auto infected = parallel
+      ? backend->run_parallel(simulation.virality, isolated, &rounds)
+      : backend->run(simulation.virality, isolated, &rounds);
+    auto exceeds = backend->exceeds(simulation.virality, isolated, limit, parallel);
+    outcomes.push_back({name, *backend, infected, round_sizes(rounds), exceeds});
+  }
+
+  for (const auto& outcome : outcomes) {
+    std::ostringstream mismatch;
+    mismatch << outcome.backend << " backend ";
+
+    if (outcome.model.percent(outcome.infected) != expected) {
+      mismatch << "infects " << outcome.model.percent(outcome.infected) << "% instead of " << expected << "%";
+      return mismatch.str();
+    }
+
+    if (outcome.rounds != expected_rounds) {
+      mismatch << "infects " << describe(outcome.rounds) << " per round instead of " << describe(expected_rounds);
+      return mismatch.str();
+    }
+
+    if (outcome.exceeds != expected_exceeds) {
+      mismatch << (outcome.exceeds ? "exceeds" : "does not exceed") << " the limit of " << limit << " persons";
+      return mismatch.str();
+    }
+  }
+
+  return {};
+}
+
+type::simulation_case differential::shrink(const type::simulation_case& simulation, const predicate& fails) {
+  type::simulation_case shrunk = simulation;
+
+  auto attempt = [&] (type::simulation_case candidate) {
+    if (!fails(candidate)) {
+      return false;
+    }
+
+    shrunk = std::move(candidate);
+    return true;
+  };
+
+  for (bool changed = true; changed;) {
+    changed = false;
+
+    // dropping the last person also drops its relations
+    while (shrunk.size > 1) {
+      auto candidate = shrunk;
+      type::person last = --candidate.size;
+      candidate.infected.erase(last);
+      std::erase_if(candidate.relations, [&] (const auto& relation) { return relation.second == last; });
+      std::erase_if(candidate.isolations, [&] (const auto& relation) { return relation.second == last; });
+      if (!attempt(std::move(candidate))) {
+        break;
+      }
+      changed = true;
+    }
+
+    for (auto relation : type::relations(shrunk.relations)) {
+      auto candidate = shrunk;
+      candidate.relations.erase(relation);
+      candidate.isolations.erase(relation);
+      changed |= attempt(std::move(candidate));
+    }
+
+    for (auto isolation : type::relations(shrunk.isolations)) {
+      auto candidate = shrunk;
+      candidate.isolations.erase(isolation);
+      changed |= attempt(std::move(candidate));
+    }
+
+    for (auto person : type::persons(shrunk.infected)) {
+      auto candidate = shrunk;
+      candidate.infected.erase(person);
+      changed |= attempt(std::move(candidate));
+    }
+
+    while (shrunk.virality > 0) {
+      auto candidate = shrunk;
+      candidate.virality--;
+      if (!attempt(std::move(candidate))) {
+        break;
+      }
+      changed = true;
+    }
+  }
+
+  return shrunk;
+}
+
+void differential::print(std::ostream& output, const type::simulation_case& simulation) {
+  output << "virality " << simulation.virality << "\n";
+  output << simulation.size << " " << simulation.infected.size() << "\n";
+
+  for (type::person i = 0; i < simulation.size; i++) {
+    for (type::person j = 0; j < simulation.size; j++) {
+      type::relation relation{std::min(i, j), std::max(i, j)};
+      output << (simulation.relations.contains(relation) ? 1 : 0) << " ";
+    }
+    output << "\n";
+  }
+
+  for (auto i : simulation.infected) {
+    output << i << " ";
+  }
+  output << "\n";
+
+  output << "isolations\n";
+  for (const auto& [i, j] : simulation.isolations) {
+    output << i << " " << j << "\n";
+  }
+}
+
+} /* namespace tp */
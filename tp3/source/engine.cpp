@@ -0,0 +1,48 @@
+#include <algorithm.hpp>
+#include <algorithm_anneal.hpp>
+#include <algorithm_components.hpp>
+#include <algorithm_greedy.hpp>
+#include <engine.hpp>
+
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace tp {
+
+engine::~engine() {}
+
+bool engine::known(const std::string& name) {
+  return name == "ga" || name == "greedy" || name == "anneal" || name == "tabu" || name == "components";
+}
+
+std::unique_ptr<engine> engine::create(const std::string& name, printer& printer, settings& settings,
+                                       criteria& criteria, statistics* statistics, const population& pop,
+                                       unsigned int chains, bool greedy_seed,
+                                       const std::vector<type::relations>& injected) {
+  if (name == "greedy") {
+    return std::make_unique<algorithm_greedy>(printer, settings, pop, &criteria);
+  }
+
+  if (name == "components") {
+    return std::make_unique<algorithm_components>(printer, settings, pop, &criteria);
+  }
+
+  if (name == "anneal" || name == "tabu") {
+    auto mode = name == "anneal" ? algorithm_anneal::mode::anneal : algorithm_anneal::mode::tabu;
+    return std::make_unique<algorithm_anneal>(printer, settings, criteria, pop, mode, chains);
+  }
+
+  auto ga = std::make_unique<algorithm>(printer, settings, criteria, statistics, pop);
+  for (const auto& isolations : injected) {
+    ga->inject(isolations);
+  }
+
+  if (greedy_seed) {
+    ga->inject(algorithm_greedy(printer, settings, pop).solve());
+  }
+
+  return ga;
+}
+
+} /* namespace tp */
@@ -0,0 +1,112 @@
+#include <differential.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <random>
+#include <string>
+
+static
+void report(const tp::type::simulation_case& simulation, const std::string& mismatch) {
+  auto shrunk = tp::differential::shrink(simulation, [] (const auto& candidate) {
+    return tp::differential::check(candidate).has_value();
+  });
+
+  std::cerr << "mismatch: " << mismatch << "\n";
+  std::cerr << "shrunk: " << tp::differential::check(shrunk).value_or(mismatch) << "\n";
+  tp::differential::print(std::cerr, shrunk);
+}
+
+extern "C" int LLVMFuzzerTestOneInput(const std::uint8_t* data, std::size_t size) {
+  auto simulation = tp::differential::from_bytes(data, size);
+  if (auto mismatch = tp::differential::check(simulation)) {
+    report(simulation, mismatch.value());
+    abort();
+  }
+
+  return 0;
+}
+
+#ifndef PANDEMIC_LIBFUZZER
+
+// every so often a case is large enough for the frontiers to go over the
+// threshold of the parallel backend
+static constexpr unsigned int k_large_period = 64;
+static constexpr unsigned int k_large_size = 4096;
+
+static
+void show_help(FILE* f, const char* exec_name) {
+  fprintf(f, "Usage: %s [OPTION]...\n", exec_name);
+  fprintf(f, "\n");
+  fprintf(f, "Compare the contagion backends against population::run on random cases.\n");
+  fprintf(f, "\n");
+  fprintf(f, "  --cases N          number of random cases to check [DEFAULT 10000]\n");
+  fprintf(f, "  --max-size N       maximum number of persons of a case [DEFAULT 64]\n");
+  fprintf(f, "  --seed N           seed of the random cases [DEFAULT 0]\n");
+  fprintf(f, "  --help             show this help\n");
+}
+
+static
+void fail_usage(const char* exec_name, const char* opt, const char* reason) {
+  fprintf(stderr, "%s: option '%s' %s\n", exec_name, opt, reason);
+  fprintf(stderr, "Try '%s --help' for more information.\n", exec_name);
+  exit(1);
+}
+
+static
+unsigned int next_count(const char* exec_name, int argc, char* argv[], int& i) {
+  if (i >= argc - 1) {
+    fail_usage(exec_name, argv[i], "requires an argument");
+  }
+
+  int count = std::stoi(std::string(argv[++i]));
+  if (count < 0) {
+    fail_usage(exec_name, argv[i-1], "requires positive number");
+  }
+
+  return count;
+}
+
+int main(int argc, char* argv[]) {
+  unsigned int cases = 10000;
+  unsigned int max_size = 64;
+  unsigned int seed = 0;
+
+  char* exec_name = argv[0];
+  for (int i = 1; i < argc; i++) {
+    if (strcmp("--cases", argv[i]) == 0) {
+      cases = next_count(exec_name, argc, argv, i);
+    } else if (strcmp("--max-size", argv[i]) == 0) {
+      max_size = next_count(exec_name, argc, argv, i);
+    } else if (strcmp("--seed", argv[i]) == 0) {
+      seed = next_count(exec_name, argc, argv, i);
+    } else if (strcmp("--help", argv[i]) == 0) {
+      show_help(stdout, exec_name);
+      exit(0);
+    } else {
+      fprintf(stderr, "%s: unrecognized option '%s'\n", exec_name, argv[i]);
+      fprintf(stderr, "Try '%s --help' for more information.\n", exec_name);
+      exit(1);
+    }
+  }
+
+  std::mt19937 generator(seed);
+  for (unsigned int i = 0; i < cases; i++) {
+    bool large = i % k_large_period == k_large_period - 1;
+    auto simulation = tp::differential::random_case(generator, large ? k_large_size : max_size);
+
+    if (auto mismatch = tp::differential::check(simulation)) {
+      std::cerr << "case " << i << " of seed " << seed << "\n";
+      report(simulation, mismatch.value());
+      return 1;
+    }
+  }
+
+  std::cout << cases << " cases match" << std::endl;
+  return 0;
+}
+
+#endif /* PANDEMIC_LIBFUZZER */
@@ -0,0 +1,44 @@
+#include <isolation_bound.hpp>
+
+#include <algorithm>
+#include <numeric>
+#include <optional>
+#include <vector>
+
+namespace tp {
+
+isolation_bound::isolation_bound(const settings& settings, const population& pop)
+  : settings_(settings), population_(pop) {}
+
+std::optional<unsigned int> isolation_bound::compute() const {
+  unsigned int allowed = population_.size() / 2;
+  unsigned int infected = population_.infected().size();
+  if (infected > allowed) {
+    return {};
+  }
+
+  std::vector<unsigned int> costs;
+  for (type::person i = 0; i < population_.size(); i++) {
+    if (population_.infected().contains(i)) {
+      continue;
+    }
+
+    auto neighbors = population_.infected(i);
+    if (neighbors == nullptr || neighbors->size() < settings_.virality()) {
+      continue;
+    }
+
+    costs.push_back(neighbors->size() - settings_.virality() + 1);
+  }
+
+  unsigned int spare = allowed - infected;
+  if (costs.size() <= spare) {
+    return 0;
+  }
+
+  auto protect = costs.size() - spare;
+  std::nth_element(costs.begin(), costs.begin() + protect, costs.end());
+  return std::accumulate(costs.begin(), costs.begin() + protect, 0u);
+}
+
+} /* namespace tp */
@@ -1,11 +1,36 @@
-#include <algorithm.hpp>
+#include <algorithm_basic.hpp>
+#include <batch.hpp>
+#include <contagion.hpp>
+#include <chromosome.hpp>
+#include <criteria.hpp>
+#include <engine.hpp>
+#include <isolation_bound.hpp>
+#include <memory.hpp>
 #include <population.hpp>
+#include <printer.hpp>
+#include <server.hpp>
 #include <settings.hpp>
+#include <solution.hpp>
+#include <statistics.hpp>
+#include <thread_pinning.hpp>
+#include <trace.hpp>
 
+#include <tbb/global_control.h>
+#include <tbb/parallel_for.h>
+#include <tbb/task_arena.h>
+
+#include <algorithm>
+#include <chrono>
 #include <cstring>
 #include <cerrno>
+#include <filesystem>
 #include <csignal>
 #include <iostream>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
 #include <unistd.h>
 
 void handle_sigsegv(int signal) {
@@ -14,15 +39,20 @@ void handle_sigsegv(int signal) {
   std::cerr << "\rSIGSEGV: application execution resumed" << std::endl;
 }
 
-tp::algorithm* algorithm;
+tp::engine* engine;
+tp::server* server;
 void handle_sigint(int signal) {
   if (signal != SIGINT) {
     return;
   }
 
   std::cerr << "\rSIGINT: stopping the algorithm" << std::endl;
-  if (algorithm != nullptr) {
-    algorithm->stop();
+  if (engine != nullptr) {
+    engine->stop();
+  }
+
+  if (server != nullptr) {
+    server->stop();
   }
 }
 
@@ -66,7 +96,7 @@ int setup_sigint_handler(void) {
   return 0;
 }
 
-int run(tp::algorithm* algo) {
+int run(tp::engine* algo) {
   if (setup_sigsegv_handler() < 0) {
     return 1;
   }
@@ -76,13 +106,201 @@ int run(tp::algorithm* algo) {
   }
 
   if (algo != nullptr) {
-    algorithm = algo;
-    algorithm->run();
+    engine = algo;
+    engine->run();
+  }
+
+  return 0;
+}
+
+int run_heuristic(const char* exec_name, const std::string& dataset, tp::settings& settings,
+                  const tp::population& population, tp::printer& printer) {
+  tp::algorithm_basic algorithm_basic(settings, population);
+
+  std::optional<tp::chromosome> best;
+  for (auto isolations : {algorithm_basic.isolate_infected(), algorithm_basic.isolate_50_percent()}) {
+    tp::chromosome candidate(settings, population, isolations);
+    auto cost = candidate.cost();
+    if (cost && (!best || cost.value() < best->isolations().size())) {
+      best.emplace(candidate);
+    }
+  }
+
+  if (!best) {
+    fprintf(stderr, "%s: neither heuristic keeps half of the population of '%s' healthy\n", exec_name,
+            dataset.c_str());
+    return 1;
   }
 
+  printer.start();
+  printer.print(best->isolations().size(), best->isolations());
   return 0;
 }
 
+class recording_printer : public tp::printer {
+  public:
+    recording_printer() : printer(false, false, false) {}
+
+    void print(unsigned int cost, const tp::relation_set& isolations) override {
+      if (!best_cost || cost <= best_cost.value()) {
+        best_cost = cost;
+        best_isolations = isolations;
+      }
+    }
+
+    std::optional<unsigned int> best_cost;
+    tp::relation_set best_isolations;
+};
+
+int run_scaling(const std::string& engine_name, tp::settings& settings, const tp::population& population,
+                unsigned int generations, unsigned int max_threads, unsigned int chains, bool greedy_seed) {
+  std::vector<unsigned int> thread_counts;
+  for (unsigned int threads = 1; threads < max_threads; threads *= 2) {
+    thread_counts.push_back(threads);
+  }
+  thread_counts.push_back(max_threads);
+
+  std::cout << "threads seconds speedup efficiency" << std::endl;
+
+  double baseline = 0;
+  for (auto threads : thread_counts) {
+    recording_printer printer;
+    tp::criteria criteria;
+    criteria.set_max_generations(generations);
+
+    auto engine = tp::engine::create(engine_name, printer, settings, criteria, nullptr, population, chains, greedy_seed);
+
+    tbb::task_arena arena(threads);
+    auto start = std::chrono::steady_clock::now();
+    arena.execute([&] { engine->run(); });
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    if (threads == 1) {
+      baseline = seconds;
+    }
+
+    double speedup = baseline / seconds;
+    printf("%u %.3f %.2f %.2f\n", threads, seconds, speedup, speedup / threads);
+    fflush(stdout);
+  }
+
+  return 0;
+}
+
+int run_batch(const tp::batch& batch, const std::map<std::string, tp::population>& populations,
+              const std::string& engine_name, const tp::settings& defaults, unsigned int chains,
+              bool greedy_seed) {
+  std::mutex output_mutex;
+  auto chains_of_jobs = batch.chains();
+
+  tbb::parallel_for(std::size_t(0), chains_of_jobs.size(), [&] (std::size_t c) {
+    std::optional<tp::type::relations> warm_start;
+
+    for (auto index : chains_of_jobs[c]) {
+      const auto& job = batch.jobs()[index];
+      const auto& population = populations.at(job.dataset);
+
+      tp::settings settings(defaults);
+      settings.set_virality(job.virality);
+      settings.set_seed(job.seed);
+
+      std::optional<unsigned int> cost;
+      auto start = std::chrono::steady_clock::now();
+
+      auto bound = tp::isolation_bound(settings, population).compute();
+      if (bound) {
+        tp::criteria criteria;
+        criteria.set_time_limit(std::chrono::milliseconds((long long) (job.seconds * 1000)));
+        criteria.set_lower_bound(bound.value());
+
+        std::vector<tp::type::relations> injected;
+        if (warm_start) {
+          injected.push_back(warm_start.value());
+        }
+
+        recording_printer printer;
+        auto engine = tp::engine::create(engine_name, printer, settings, criteria, nullptr, population,
+                                         chains, greedy_seed, injected);
+        engine->run();
+
+        cost = printer.best_cost;
+        if (cost) {
+          warm_start = printer.best_isolations.relations();
+        }
+      }
+
+      double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+      std::lock_guard<std::mutex> lock(output_mutex);
+      if (cost) {
+        printf("%s %u %u %u %.3f\n", job.dataset.c_str(), job.virality, job.seed, cost.value(), seconds);
+      } else {
+        printf("%s %u %u - %.3f\n", job.dataset.c_str(), job.virality, job.seed, seconds);
+      }
+      fflush(stdout);
+    }
+  });
+
+  return 0;
+}
+
+int run_verify(const char* exec_name, const std::filesystem::path& path, const tp::population& population,
+               unsigned int virality) {
+  std::vector<std::filesystem::path> files;
+  std::error_code error;
+  if (std::filesystem::is_directory(path, error)) {
+    for (const auto& entry : std::filesystem::directory_iterator(path, error)) {
+      if (entry.is_regular_file()) {
+        files.push_back(entry.path());
+      }
+    }
+
+    // an unreadable or empty directory must not pass for a valid one
+    if (error) {
+      fprintf(stderr, "%s: fail to read directory '%s': %s\n", exec_name, path.c_str(), error.message().c_str());
+      return 1;
+    }
+
+    if (files.empty()) {
+      fprintf(stderr, "%s: no solution file in directory '%s'\n", exec_name, path.c_str());
+      return 1;
+    }
+
+    std::sort(files.begin(), files.end());
+  } else {
+    files.push_back(path);
+  }
+
+  tp::contagion contagion(population);
+  std::vector<tp::type::verdict> verdicts(files.size());
+
+  tbb::parallel_for(std::size_t(0), files.size(), [&] (std::size_t i) {
+    auto solution_file = tp::solution::from_file(files[i]);
+    if (solution_file.index()) {
+      verdicts[i].reason = std::get<std::string>(solution_file);
+      return;
+    }
+
+    verdicts[i] = std::get<tp::solution>(solution_file).verify(contagion, virality);
+  });
+
+  bool valid = true;
+  for (std::size_t i = 0; i < files.size(); i++) {
+    const auto& verdict = verdicts[i];
+    printf("%s %s %u %.2f", files[i].c_str(), verdict.valid ? "valid" : "invalid",
+           verdict.cost, verdict.infected_percent);
+
+    if (verdict.reason) {
+      printf(" %s", verdict.reason->c_str());
+    }
+
+    printf("\n");
+    valid = valid && verdict.valid;
+  }
+
+  return valid ? 0 : 2;
+}
+
 static
 void show_help(FILE* f, const char* exec_name) {
   fprintf(f, "Usage: %s [OPTION]...\n", exec_name);
@@ -91,6 +309,49 @@ void show_help(FILE* f, const char* exec_name) {
   fprintf(f, "  --virality N       the propagation rate of the virus\n");
   fprintf(f, "  --solutions        print new solutions each time they're found\n");
   fprintf(f, "  --timestamp        print timestamp each time a new solution is found\n"); 
+  fprintf(f, "  --bound            print the lower bound on the cost next to each new cost\n");
+  fprintf(f, "  --engine NAME      search engine to run: ga [DEFAULT], greedy, anneal, tabu or\n");
+  fprintf(f, "                     components\n");
+  fprintf(f, "  --chains N         number of independent anneal or tabu chains\n");
+  fprintf(f, "  --greedy-seed      add the greedy engine solution to the initial population\n");
+  fprintf(f, "  --initial-solution FILE\n");
+  fprintf(f, "                     add the last solution of FILE and variants of it to the\n");
+  fprintf(f, "                     initial population, can be repeated\n");
+  fprintf(f, "  --heuristic-only   print the best constructive heuristic solution and exit\n");
+  fprintf(f, "  --time-limit S     stop after S seconds\n");
+  fprintf(f, "  --max-generations N\n");
+  fprintf(f, "                     stop after N generations\n");
+  fprintf(f, "  --target-cost N    stop once a solution costing N or less is found\n");
+  fprintf(f, "  --stagnation N     stop after N generations without improvement\n");
+  fprintf(f, "  --chromosomes N    number of chromosomes kept each generation\n");
+  fprintf(f, "  --crosses N        number of crosses each generation\n");
+  fprintf(f, "  --mutations N      number of mutations each generation\n");
+  fprintf(f, "  --mutation-add N   maximum isolations added by a mutation\n");
+  fprintf(f, "  --mutation-remove N\n");
+  fprintf(f, "                     maximum isolations removed by a mutation\n");
+  fprintf(f, "  --mutation-update N\n");
+  fprintf(f, "                     maximum isolations moved by a mutation\n");
+  fprintf(f, "  --increase-add N   maximum isolations added to repair an invalid chromosome\n");
+  fprintf(f, "  --adaptive         move the crosses and mutations budget toward the operator\n");
+  fprintf(f, "                     producing surviving children\n");
+  fprintf(f, "  --batch FILE       run the jobs listed in FILE, one 'dataset virality seed\n");
+  fprintf(f, "                     seconds' per line, and print 'dataset virality seed cost\n");
+  fprintf(f, "                     seconds' for each\n");
+  fprintf(f, "  --verify PATH      check the last solution of the file PATH, or of each file\n");
+  fprintf(f, "                     in the directory PATH, and print 'file valid|invalid cost\n");
+  fprintf(f, "                     infected_percent [reason]'; exits with 2 if one is invalid\n");
+  fprintf(f, "  --serve SOCKET     keep datasets loaded and solve the requests of the clients\n");
+  fprintf(f, "                     of the Unix socket SOCKET\n");
+  fprintf(f, "  --seed N           seed the random generators with N\n");
+  fprintf(f, "  --threads N        run on at most N threads\n");
+  fprintf(f, "  --pin              pin each thread to its own core\n");
+  fprintf(f, "  --scaling N        time N generations on 1, 2, 4... threads and report the\n");
+  fprintf(f, "                     speedup and efficiency of each thread count\n");
+  fprintf(f, "  --stats FILE       write per-generation statistics to FILE as CSV\n");
+  fprintf(f, "  --trace FILE       write a Chrome trace of the run to FILE\n");
+  fprintf(f, "  --output FILE      keep the best solution found in FILE, written in the\n");
+  fprintf(f, "                     background as it improves\n");
+  fprintf(f, "  --memory           print the memory held by the dataset structures at startup\n");
   fprintf(f, "  --help             show this help\n");
 }
 
@@ -115,6 +376,26 @@ void fail_negative_arg(const char* exec_name, const char* opt) {
   exit(1);
 }
 
+static
+const char* next_arg(const char* exec_name, int argc, char* argv[], int& i) {
+  if (i >= argc - 1) {
+    fail_missing_arg(exec_name, argv[i]);
+  }
+
+  return argv[++i];
+}
+
+static
+unsigned int next_count(const char* exec_name, int argc, char* argv[], int& i) {
+  int count = std::stoi(std::string(next_arg(exec_name, argc, argv, i)));
+
+  if (count < 0) {
+    fail_negative_arg(exec_name, argv[i-1]);
+  }
+
+  return count;
+}
+
 static
 void fail_incompatible_opts(const char* exec_name, const char* opt1, const char* opt2) {
   fprintf(stderr, "%s: option '%s' is incompatible with '%s'\n", exec_name, opt1, opt2);
@@ -122,6 +403,13 @@ void fail_incompatible_opts(const char* exec_name, const char* opt1, const char*
   exit(1);
 }
 
+static
+void fail_open_stats(const char* exec_name, const char* filename, const char* reason) {
+  fprintf(stderr, "%s: fail to open statistics file '%s': %s\n", exec_name, filename, reason);
+  fprintf(stderr, "Try '%s --help' for more information.\n", exec_name);
+  exit(1);
+}
+
 static
 void fail_load_dataset(const char* exec_name, const char* filename, const char* reason) {
   fprintf(stderr, "%s: fail to load dataset file '%s': %s\n", exec_name, filename, reason);
@@ -129,11 +417,78 @@ void fail_load_dataset(const char* exec_name, const char* filename, const char*
   exit(1);
 }
 
+static
+void fail_load_batch(const char* exec_name, const char* filename, const char* reason) {
+  fprintf(stderr, "%s: fail to load batch file '%s': %s\n", exec_name, filename, reason);
+  fprintf(stderr, "Try '%s --help' for more information.\n", exec_name);
+  exit(1);
+}
+
+static
+void fail_initial_solution(const char* exec_name, const char* filename, const char* reason) {
+  fprintf(stderr, "%s: fail to load initial solution '%s': %s\n", exec_name, filename, reason);
+  fprintf(stderr, "Try '%s --help' for more information.\n", exec_name);
+  exit(1);
+}
+
+static
+void fail_unknown_engine(const char* exec_name, const char* name) {
+  fprintf(stderr, "%s: unknown engine '%s'\n", exec_name, name);
+  fprintf(stderr, "Try '%s --help' for more information.\n", exec_name);
+  exit(1);
+}
+
+static
+void fail_write_output(const char* exec_name, const char* filename, const char* reason) {
+  fprintf(stderr, "%s: fail to write output file '%s': %s\n", exec_name, filename, reason);
+  exit(1);
+}
+
+static
+void fail_impossible(const char* exec_name, const char* filename) {
+  fprintf(stderr, "%s: more than half of the population of '%s' is already infected\n", exec_name, filename);
+  exit(1);
+}
+
+// each engine builds its own contagion, so only its footprint is reported
+static
+void report_memory(const tp::population& population) {
+  auto allocations = tp::memory::allocations();
+
+  fprintf(stderr, "memory: population %s, contagion %s, %llu allocations of %s, peak rss %s\n",
+          tp::memory::format(population.footprint()).c_str(),
+          tp::memory::format(tp::contagion::footprint(population)).c_str(),
+          (unsigned long long) allocations.count,
+          tp::memory::format(allocations.bytes).c_str(),
+          tp::memory::format(tp::memory::peak_rss()).c_str());
+}
+
 int main(int argc, char* argv[]) {
   std::string dataset = "../exemplaires/1000_3000_30_0.txt";
   unsigned int virality = 3;
   bool print_solutions = false;
   bool print_timestamp = false;
+  bool print_bound = false;
+  bool heuristic_only = false;
+  bool greedy_seed = false;
+  std::string engine_name = "ga";
+  std::optional<unsigned int> chains;
+  std::optional<unsigned int> threads;
+  std::optional<unsigned int> scaling;
+  bool pin = false;
+  bool memory = false;
+  tp::settings settings(virality);
+  tp::criteria criteria;
+  unsigned int mutation_add_max = settings.mutation_add_max();
+  unsigned int mutation_remove_max = settings.mutation_remove_max();
+  unsigned int mutation_update_max = settings.mutation_update_max();
+  std::optional<std::string> stats_file;
+  std::optional<std::string> trace_file;
+  std::optional<std::string> batch_file;
+  std::optional<std::string> serve_socket;
+  std::optional<std::string> verify_path;
+  std::optional<std::string> output_file;
+  std::vector<std::string> initial_solutions;
 
   char* exec_name = argv[0];
   for (int i = 1; i < argc; i++) {
@@ -153,10 +508,83 @@ int main(int argc, char* argv[]) {
       if (virality < 0) {
         fail_negative_arg(exec_name, argv[i-1]);
       }
+    } else if (strcmp("--time-limit", argv[i]) == 0) {
+      float seconds = std::stof(std::string(next_arg(exec_name, argc, argv, i)));
+
+      if (seconds < 0) {
+        fail_negative_arg(exec_name, argv[i-1]);
+      }
+
+      criteria.set_time_limit(std::chrono::milliseconds((long long) (seconds * 1000)));
+    } else if (strcmp("--max-generations", argv[i]) == 0) {
+      criteria.set_max_generations(next_count(exec_name, argc, argv, i));
+    } else if (strcmp("--target-cost", argv[i]) == 0) {
+      criteria.set_target_cost(next_count(exec_name, argc, argv, i));
+    } else if (strcmp("--stagnation", argv[i]) == 0) {
+      criteria.set_stagnation(next_count(exec_name, argc, argv, i));
+    } else if (strcmp("--chromosomes", argv[i]) == 0) {
+      unsigned int chromosome_count = next_count(exec_name, argc, argv, i);
+      if (chromosome_count == 0) {
+        fail_negative_arg(exec_name, argv[i-1]);
+      }
+
+      settings.set_chromosome_count(chromosome_count);
+    } else if (strcmp("--crosses", argv[i]) == 0) {
+      settings.set_cross_count(next_count(exec_name, argc, argv, i));
+    } else if (strcmp("--mutations", argv[i]) == 0) {
+      settings.set_mutation_count(next_count(exec_name, argc, argv, i));
+    } else if (strcmp("--mutation-add", argv[i]) == 0) {
+      mutation_add_max = next_count(exec_name, argc, argv, i);
+    } else if (strcmp("--mutation-remove", argv[i]) == 0) {
+      mutation_remove_max = next_count(exec_name, argc, argv, i);
+    } else if (strcmp("--mutation-update", argv[i]) == 0) {
+      mutation_update_max = next_count(exec_name, argc, argv, i);
+    } else if (strcmp("--increase-add", argv[i]) == 0) {
+      settings.set_increase_add_max(next_count(exec_name, argc, argv, i));
+    } else if (strcmp("--adaptive", argv[i]) == 0) {
+      settings.set_adaptive(true);
+    } else if (strcmp("--batch", argv[i]) == 0) {
+      batch_file = next_arg(exec_name, argc, argv, i);
+    } else if (strcmp("--verify", argv[i]) == 0) {
+      verify_path = next_arg(exec_name, argc, argv, i);
+    } else if (strcmp("--serve", argv[i]) == 0) {
+      serve_socket = next_arg(exec_name, argc, argv, i);
+    } else if (strcmp("--seed", argv[i]) == 0) {
+      settings.set_seed(next_count(exec_name, argc, argv, i));
+    } else if (strcmp("--threads", argv[i]) == 0) {
+      threads = std::max(next_count(exec_name, argc, argv, i), 1u);
+    } else if (strcmp("--pin", argv[i]) == 0) {
+      pin = true;
+    } else if (strcmp("--scaling", argv[i]) == 0) {
+      scaling = next_count(exec_name, argc, argv, i);
+    } else if (strcmp("--stats", argv[i]) == 0) {
+      stats_file = next_arg(exec_name, argc, argv, i);
+    } else if (strcmp("--trace", argv[i]) == 0) {
+      trace_file = next_arg(exec_name, argc, argv, i);
     } else if (strcmp("--solutions", argv[i]) == 0) {
       print_solutions = true;
     } else if (strcmp("--timestamp", argv[i]) == 0) {
       print_timestamp = true;
+    } else if (strcmp("--bound", argv[i]) == 0) {
+      print_bound = true;
+    } else if (strcmp("--engine", argv[i]) == 0) {
+      engine_name = next_arg(exec_name, argc, argv, i);
+
+      if (!tp::engine::known(engine_name)) {
+        fail_unknown_engine(exec_name, engine_name.c_str());
+      }
+    } else if (strcmp("--chains", argv[i]) == 0) {
+      chains = next_count(exec_name, argc, argv, i);
+    } else if (strcmp("--initial-solution", argv[i]) == 0) {
+      initial_solutions.push_back(next_arg(exec_name, argc, argv, i));
+    } else if (strcmp("--greedy-seed", argv[i]) == 0) {
+      greedy_seed = true;
+    } else if (strcmp("--heuristic-only", argv[i]) == 0) {
+      heuristic_only = true;
+    } else if (strcmp("--output", argv[i]) == 0) {
+      output_file = next_arg(exec_name, argc, argv, i);
+    } else if (strcmp("--memory", argv[i]) == 0) {
+      memory = true;
     } else if (strcmp("--help", argv[i]) == 0) {
       show_help(stdout, exec_name);
       exit(0);
@@ -165,17 +593,170 @@ int main(int argc, char* argv[]) {
     }
   }
 
+  settings.set_virality(virality);
+  settings.set_mutation_max(mutation_add_max, mutation_remove_max, mutation_update_max);
+
   if (print_solutions && print_timestamp) {
     fail_incompatible_opts(exec_name, "--solutions", "--timestamp");
   }
 
+  if (print_solutions && print_bound) {
+    fail_incompatible_opts(exec_name, "--solutions", "--bound");
+  }
+
+  std::optional<tbb::global_control> thread_limit;
+  if (threads) {
+    thread_limit.emplace(tbb::global_control::max_allowed_parallelism, threads.value());
+  }
+
+  std::optional<tp::thread_pinning> thread_pinning;
+  if (pin) {
+    thread_pinning.emplace();
+  }
+
+  unsigned int max_threads = threads.value_or(tbb::this_task_arena::max_concurrency());
+
+  if (serve_socket) {
+    tp::server socket_server(settings, chains.value_or(1));
+    server = &socket_server;
+    if (setup_sigint_handler() < 0) {
+      return 1;
+    }
+
+    auto error = socket_server.serve(serve_socket.value());
+    server = nullptr;
+
+    if (error) {
+      fprintf(stderr, "%s: fail to serve on '%s': %s\n", exec_name, serve_socket->c_str(), error->c_str());
+      return 1;
+    }
+
+    return 0;
+  }
+
+  if (batch_file) {
+    auto batch = tp::batch::from_file(batch_file.value());
+    if (batch.index()) {
+      fail_load_batch(exec_name, batch_file->c_str(), std::get<std::string>(batch).c_str());
+    }
+
+    std::map<std::string, tp::population> populations;
+    for (const auto& path : std::get<tp::batch>(batch).datasets()) {
+      auto population_file = tp::population::from_file(path);
+      if (population_file.index()) {
+        fail_load_dataset(exec_name, path.c_str(), std::get<std::string>(population_file).c_str());
+      }
+
+      populations.emplace(path, std::get<tp::population>(population_file));
+    }
+
+    if (engine_name != "ga") {
+      fprintf(stderr, "%s: warning: only '--engine ga' starts a job from the solution of the previous one\n",
+              exec_name);
+    }
+
+    return run_batch(std::get<tp::batch>(batch), populations, engine_name, settings,
+                     chains.value_or(1), greedy_seed);
+  }
+
   auto population_file = tp::population::from_file(dataset);
   if (population_file.index()) {
     fail_load_dataset(exec_name, dataset.c_str(), std::get<std::string>(population_file).c_str());
   }
 
-  tp::settings settings(virality);
+  std::optional<tp::statistics> statistics;
+  if (stats_file) {
+    auto statistics_file = tp::statistics::from_file(stats_file.value());
+    if (statistics_file.index()) {
+      fail_open_stats(exec_name, stats_file->c_str(), std::get<std::string>(statistics_file).c_str());
+    }
+
+    statistics.emplace(std::move(std::get<tp::statistics>(statistics_file)));
+  }
+
   tp::population population = std::get<tp::population>(population_file);
-  tp::algorithm algorithm(print_solutions, print_timestamp, settings, population);
-  return run(&algorithm);
+  if (memory) {
+    report_memory(population);
+  }
+
+  if (verify_path) {
+    return run_verify(exec_name, verify_path.value(), population, settings.virality());
+  }
+
+  auto bound = tp::isolation_bound(settings, population).compute();
+  if (!bound) {
+    fail_impossible(exec_name, dataset.c_str());
+  }
+
+  criteria.set_lower_bound(bound.value());
+
+  tp::printer printer(print_solutions, print_timestamp, print_bound);
+  printer.set_lower_bound(bound.value());
+  if (output_file) {
+    printer.set_output(output_file.value());
+  }
+
+  if (heuristic_only) {
+    int status = run_heuristic(exec_name, dataset, settings, population, printer);
+    if (auto error = printer.close_output()) {
+      fail_write_output(exec_name, output_file->c_str(), error->c_str());
+    }
+
+    return status;
+  }
+
+  if (scaling) {
+    return run_scaling(engine_name, settings, population, scaling.value(), max_threads,
+                       chains.value_or(max_threads), greedy_seed);
+  }
+
+  if (trace_file) {
+    tp::trace::enable();
+  }
+
+  std::vector<tp::type::relations> injected;
+  if (!initial_solutions.empty()) {
+    tp::contagion contagion(population);
+    for (const auto& path : initial_solutions) {
+      auto solution_file = tp::solution::from_file(path);
+      if (solution_file.index()) {
+        fail_initial_solution(exec_name, path.c_str(), std::get<std::string>(solution_file).c_str());
+      }
+
+      auto relations = std::get<tp::solution>(solution_file).relations();
+      for (const auto& relation : relations) {
+        if (!contagion.relation_id(relation)) {
+          fail_initial_solution(exec_name, path.c_str(), "isolated relation is not in the dataset");
+        }
+      }
+
+      injected.push_back(relations);
+    }
+  }
+
+  tp::statistics* statistics_ptr = statistics ? &statistics.value() : nullptr;
+  auto engine = tp::engine::create(engine_name, printer, settings, criteria, statistics_ptr, population,
+                                   chains.value_or(max_threads), greedy_seed, injected);
+
+  int status = run(engine.get());
+
+  if (auto error = printer.close_output()) {
+    fail_write_output(exec_name, output_file->c_str(), error->c_str());
+  }
+
+  if (trace_file) {
+    auto error = tp::trace::write(trace_file.value());
+    if (error) {
+      fprintf(stderr, "%s: fail to write trace file '%s': %s\n", exec_name, trace_file->c_str(), error->c_str());
+      return 1;
+    }
+  }
+
+  if (status == 0 && !printer.printed()) {
+    fprintf(stderr, "%s: no solution keeping half of the population of '%s' healthy was found\n", exec_name,
+            dataset.c_str());
+    return 1;
+  }
+
+  return status;
 }
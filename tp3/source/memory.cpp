@@ -0,0 +1,145 @@
+#include <memory.hpp>
+
+#include <sys/resource.h>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <new>
+#include <string>
+
+// every thread counts on its own cache line, so allocating threads never
+// contend, and the counters are only summed when read; past k_counter_slots
+// threads, slots are shared, which is why the counters stay atomic
+struct alignas(64) counters {
+  std::atomic<std::uint64_t> count{0};
+  std::atomic<std::uint64_t> bytes{0};
+  std::atomic<std::uint64_t> frees{0};
+};
+
+static constexpr std::size_t k_counter_slots = 256;
+static counters counter_slots[k_counter_slots];
+static std::atomic<std::size_t> next_counter_slot{0};
+
+// a plain pointer, so that reaching it never allocates
+static thread_local counters* thread_counters = nullptr;
+
+static
+counters& local_counters() {
+  if (thread_counters == nullptr) {
+    thread_counters = &counter_slots[next_counter_slot.fetch_add(1, std::memory_order_relaxed) % k_counter_slots];
+  }
+
+  return *thread_counters;
+}
+
+static
+void count_allocation(std::size_t size) {
+  auto& local = local_counters();
+  local.count.fetch_add(1, std::memory_order_relaxed);
+  local.bytes.fetch_add(size, std::memory_order_relaxed);
+}
+
+static
+void count_free(void* allocated) {
+  if (allocated != nullptr) {
+    local_counters().frees.fetch_add(1, std::memory_order_relaxed);
+  }
+}
+
+static
+void* allocate(std::size_t size, std::size_t alignment) {
+  count_allocation(size);
+
+  if (size == 0) {
+    size = 1;
+  }
+
+  while (true) {
+    void* allocated = nullptr;
+    if (alignment <= alignof(std::max_align_t)) {
+      allocated = std::malloc(size);
+    } else {
+      // aligned_alloc wants a size multiple of the alignment
+      allocated = std::aligned_alloc(alignment, (size + alignment - 1) / alignment * alignment);
+    }
+
+    if (allocated != nullptr) {
+      return allocated;
+    }
+
+    auto handler = std::get_new_handler();
+    if (handler == nullptr) {
+      throw std::bad_alloc();
+    }
+
+    handler();
+  }
+}
+
+void* operator new(std::size_t size) {
+  return allocate(size, alignof(std::max_align_t));
+}
+
+void* operator new(std::size_t size, std::align_val_t alignment) {
+  return allocate(size, static_cast<std::size_t>(alignment));
+}
+
+void operator delete(void* allocated) noexcept {
+  count_free(allocated);
+  std::free(allocated);
+}
+
+void operator delete(void* allocated, std::size_t) noexcept {
+  operator delete(allocated);
+}
+
+void operator delete(void* allocated, std::align_val_t) noexcept {
+  operator delete(allocated);
+}
+
+void operator delete(void* allocated, std::size_t, std::align_val_t) noexcept {
+  operator delete(allocated);
+}
+
+namespace tp {
+
+type::allocations memory::allocations() {
+  type::allocations total;
+  for (const auto& slot : counter_slots) {
+    total.count += slot.count.load(std::memory_order_relaxed);
+    total.bytes += slot.bytes.load(std::memory_order_relaxed);
+    total.frees += slot.frees.load(std::memory_order_relaxed);
+  }
+
+  return total;
+}
+
+std::size_t memory::peak_rss() {
+  struct rusage usage;
+  if (getrusage(RUSAGE_SELF, &usage) != 0) {
+    return 0;
+  }
+
+  // kilobytes on Linux
+  return static_cast<std::size_t>(usage.ru_maxrss) * 1024;
+}
+
+std::string memory::format(std::size_t bytes) {
+  const char* units[] = {"B", "KiB", "MiB", "GiB"};
+  double value = bytes;
+  unsigned int unit = 0;
+
+  while (value >= 1024 && unit < 3) {
+    value /= 1024;
+    unit++;
+  }
+
+  char formatted[32];
+  snprintf(formatted, sizeof(formatted), unit == 0 ? "%.0f %s" : "%.1f %s", value, units[unit]);
+  return formatted;
+}
+
+} /* namespace tp */
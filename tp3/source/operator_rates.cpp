@@ -0,0 +1,46 @@
+#include <operator_rates.hpp>
+#include <settings.hpp>
+
+#include <algorithm>
+
+namespace tp {
+
+operator_rates::operator_rates(const settings& settings)
+  : budget_(2 * settings.cross_count() + settings.mutation_count()),
+    cross_rate_(0), mutation_rate_(0),
+    cross_count_(settings.cross_count()), mutation_count_(settings.mutation_count()) {}
+
+unsigned int operator_rates::cross_count() const {
+  return cross_count_;
+}
+
+unsigned int operator_rates::mutation_count() const {
+  return mutation_count_;
+}
+
+void operator_rates::update(unsigned int crossed, unsigned int cross_successes,
+                            unsigned int mutated, unsigned int mutation_successes) {
+  if (crossed != 0) {
+    float rate = ((float) cross_successes) / ((float) crossed);
+    cross_rate_ = (1 - k_smoothing) * cross_rate_ + k_smoothing * rate;
+  }
+
+  if (mutated != 0) {
+    float rate = ((float) mutation_successes) / ((float) mutated);
+    mutation_rate_ = (1 - k_smoothing) * mutation_rate_ + k_smoothing * rate;
+  }
+
+  // below one cross and one mutation the budget cannot be shared, so the
+  // configured counts are kept
+  float total = cross_rate_ + mutation_rate_;
+  if (total <= 0 || budget_ < 3) {
+    return;
+  }
+
+  float cross_share = std::clamp(cross_rate_ / total, k_min_share, 1 - k_min_share);
+
+  cross_count_ = std::clamp((unsigned int) (cross_share * budget_ / 2), 1u, (budget_ - 1) / 2);
+  mutation_count_ = budget_ - 2 * cross_count_;
+}
+
+} /* namespace tp */
@@ -1,3 +1,4 @@
+#include <memory.hpp>
 #include <population.hpp>
 
 #include <algorithm>
@@ -5,6 +6,7 @@
 #include <cstring>
 #include <filesystem>
 #include <fstream>
+#include <mutex>
 #include <variant>
 
 namespace tp {
@@ -53,6 +55,22 @@ unsigned int population::size() const {
   return size_;
 }
 
+std::size_t population::footprint() const {
+  std::size_t bytes = 0;
+
+  for (const auto* adjacents : {&relations_, &infected_relations_}) {
+    bytes += adjacents->size() * memory::tree_node<type::adjacents::value_type>();
+    for (const auto& [i, persons] : *adjacents) {
+      bytes += persons.size() * memory::tree_node<type::person>();
+    }
+  }
+
+  bytes += all_relations_.size() * memory::tree_node<type::relation>();
+  bytes += relation_index_.footprint();
+  bytes += all_infected_.size() * memory::tree_node<type::person>();
+  return bytes;
+}
+
 void population::add_relation(const type::relation& relation) {
   auto [i, j] = relation;
 
@@ -68,6 +86,8 @@ void population::add_relation(const type::relation& relation) {
     return;
   }
 
+  relation_index_.reset();
+
   auto i_it = relations_.find(i);
   if (i_it == relations_.end()) {
     auto inserted = relations_.emplace(i, type::persons{});
@@ -124,13 +144,20 @@ void population::remove_relation(const type::relation& relation) {
     infected_relations_it_j->second.erase(i);
   }
 
-  all_relations_.erase({i, j});
+  if (all_relations_.erase({i, j}) != 0) {
+    relation_index_.reset();
+  }
 }
 
 const type::relations& population::relations() const {
   return all_relations_;
 }
 
+// relations in their sorted order, for drawing one at random
+const type::relation& population::relation(std::size_t index) const {
+  return relation_index_.at(all_relations_, index);
+}
+
 const type::persons* population::relations(type::person i) const {
   auto it = relations_.find(i);
   if (it == relations_.end()) {
@@ -230,4 +257,27 @@ void population::update_infected(type::person i) {
   }
 }
 
+const type::relation& population::relation_index::at(const type::relations& relations, std::size_t index) const {
+  if (!built_.load(std::memory_order_acquire)) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (!built_.load(std::memory_order_relaxed)) {
+      relations_.assign(relations.begin(), relations.end());
+      built_.store(true, std::memory_order_release);
+    }
+  }
+
+  return relations_[index];
+}
+
+void population::relation_index::reset() {
+  if (built_) {
+    relations_ = {};
+    built_ = false;
+  }
+}
+
+std::size_t population::relation_index::footprint() const {
+  return built_ ? memory::vector(relations_) : 0;
+}
+
 } /* namespace tp */
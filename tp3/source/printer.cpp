@@ -0,0 +1,70 @@
+#include <printer.hpp>
+#include <relation_set.hpp>
+#include <solution_sink.hpp>
+
+#include <chrono>
+#include <filesystem>
+#include <iostream>
+#include <memory>
+#include <optional>
+#include <string>
+
+namespace tp {
+
+printer::printer(bool print_solutions, bool print_timestamp, bool print_bound)
+  : print_solutions_(print_solutions), print_timestamp_(print_timestamp), print_bound_(print_bound), printed_(false),
+    start_time_(std::chrono::high_resolution_clock::now()) {}
+
+printer::~printer() {}
+
+void printer::start() {
+  start_time_ = std::chrono::high_resolution_clock::now();
+}
+
+void printer::set_lower_bound(unsigned int bound) {
+  lower_bound_ = bound;
+}
+
+void printer::set_output(const std::filesystem::path& path) {
+  output_ = std::make_unique<solution_sink>(path);
+}
+
+std::optional<std::string> printer::close_output() {
+  if (!output_) {
+    return {};
+  }
+
+  return output_->close();
+}
+
+void printer::print(unsigned int cost, const relation_set& isolations) {
+  printed_ = true;
+
+  if (output_) {
+    output_->submit(cost, isolations);
+  }
+
+  if (print_solutions_) {
+    std::cout << std::endl << solution_sink::format(isolations);
+    return;
+  }
+
+  std::cout << cost;
+
+  if (print_timestamp_) {
+    auto elapsed = std::chrono::high_resolution_clock::now() - start_time_;
+    std::cout << " " << elapsed.count();
+  }
+
+  if (print_bound_ && lower_bound_) {
+    std::cout << " " << lower_bound_.value();
+  }
+
+  std::cout << std::endl;
+}
+
+bool printer::printed() const {
+  return printed_;
+}
+
+} /* namespace tp */
@@ -0,0 +1,237 @@
+#include <memory.hpp>
+#include <relation_set.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <memory>
+#include <unordered_set>
+#include <vector>
+
+namespace tp {
+
+relation_set::iterator::iterator(const chunks* chunks, std::size_t chunk, std::size_t offset)
+  : chunks_(chunks), chunk_(chunk), offset_(offset) {}
+
+relation_set::iterator::reference relation_set::iterator::operator*() const {
+  return (*(*chunks_)[chunk_])[offset_];
+}
+
+relation_set::iterator::pointer relation_set::iterator::operator->() const {
+  return &**this;
+}
+
+relation_set::iterator& relation_set::iterator::operator++() {
+  if (++offset_ == (*chunks_)[chunk_]->size()) {
+    chunk_++;
+    offset_ = 0;
+  }
+
+  return *this;
+}
+
+relation_set::iterator relation_set::iterator::operator++(int) {
+  iterator previous = *this;
+  ++*this;
+  return previous;
+}
+
+bool relation_set::iterator::operator==(const iterator& other) const {
+  return chunk_ == other.chunk_ && offset_ == other.offset_;
+}
+
+relation_set::relation_set(const type::relations& relations) {
+  std::shared_ptr<chunk> current;
+
+  for (const auto& relation : relations) {
+    if (!current || current->size() == k_chunk_size) {
+      current = std::make_shared<chunk>();
+      current->reserve(k_chunk_size);
+      chunks_.push_back(current);
+    }
+
+    current->push_back(relation);
+  }
+
+  size_ = relations.size();
+}
+
+relation_set relation_set::from_sorted(const std::vector<type::relation>& sorted) {
+  relation_set set;
+
+  for (std::size_t i = 0; i < sorted.size(); i += k_chunk_size) {
+    auto last = std::min(i + k_chunk_size, sorted.size());
+    set.chunks_.push_back(std::make_shared<chunk>(sorted.begin() + i, sorted.begin() + last));
+  }
+
+  set.size_ = sorted.size();
+  return set;
+}
+
+std::size_t relation_set::size() const {
+  return size_;
+}
+
+bool relation_set::empty() const {
+  return size_ == 0;
+}
+
+bool relation_set::contains(const type::relation& relation) const {
+  if (chunks_.empty()) {
+    return false;
+  }
+
+  const chunk& found = *chunks_[find_chunk(relation)];
+  return std::binary_search(found.begin(), found.end(), relation);
+}
+
+const type::relation& relation_set::nth(std::size_t index) const {
+  for (const auto& current : chunks_) {
+    if (index < current->size()) {
+      return (*current)[index];
+    }
+
+    index -= current->size();
+  }
+
+  return chunks_.back()->back();
+}
+
+relation_set::iterator relation_set::begin() const {
+  return iterator(&chunks_, 0, 0);
+}
+
+relation_set::iterator relation_set::end() const {
+  return iterator(&chunks_, chunks_.size(), 0);
+}
+
+bool relation_set::insert(const type::relation& relation) {
+  if (chunks_.empty()) {
+    chunks_.push_back(std::make_shared<chunk>(1, relation));
+    size_ = 1;
+    return true;
+  }
+
+  auto index = find_chunk(relation);
+  const chunk& found = *chunks_[index];
+  std::size_t position = std::lower_bound(found.begin(), found.end(), relation) - found.begin();
+  if (position != found.size() && found[position] == relation) {
+    return false;
+  }
+
+  chunk& owned = own(index);
+  owned.insert(owned.begin() + position, relation);
+  size_++;
+
+  // chunks are split once they double so that an edit never clones more
+  // than a couple of chunk sizes
+  if (owned.size() >= 2 * k_chunk_size) {
+    auto half = owned.begin() + owned.size() / 2;
+    chunks_.insert(chunks_.begin() + index + 1, std::make_shared<chunk>(half, owned.end()));
+    owned.erase(half, owned.end());
+  }
+
+  return true;
+}
+
+bool relation_set::erase(const type::relation& relation) {
+  if (chunks_.empty()) {
+    return false;
+  }
+
+  auto index = find_chunk(relation);
+  const chunk& found = *chunks_[index];
+  std::size_t position = std::lower_bound(found.begin(), found.end(), relation) - found.begin();
+  if (position == found.size() || found[position] != relation) {
+    return false;
+  }
+
+  if (found.size() == 1) {
+    chunks_.erase(chunks_.begin() + index);
+  } else {
+    chunk& owned = own(index);
+    owned.erase(owned.begin() + position);
+  }
+
+  size_--;
+  return true;
+}
+
+type::relations relation_set::relations() const {
+  return type::relations(begin(), end());
+}
+
+std::size_t relation_set::chunk_count() const {
+  return chunks_.size();
+}
+
+std::size_t relation_set::shared_chunks(const relation_set& other) const {
+  std::unordered_set<const chunk*> others;
+  for (const auto& current : other.chunks_) {
+    others.insert(current.get());
+  }
+
+  return std::count_if(chunks_.begin(), chunks_.end(), [&] (const auto& current) {
+    return others.contains(current.get());
+  });
+}
+
+std::size_t relation_set::footprint() const {
+  std::size_t bytes = memory::vector(chunks_);
+  for (const auto& current : chunks_) {
+    bytes += chunk_footprint(*current);
+  }
+
+  return bytes;
+}
+
+std::size_t relation_set::footprint(const std::vector<const relation_set*>& sets) {
+  std::unordered_set<const chunk*> counted;
+  std::size_t bytes = 0;
+
+  for (auto set : sets) {
+    bytes += memory::vector(set->chunks_);
+    for (const auto& current : set->chunks_) {
+      if (counted.insert(current.get()).second) {
+        bytes += chunk_footprint(*current);
+      }
+    }
+  }
+
+  return bytes;
+}
+
+bool relation_set::operator==(const relation_set& other) const {
+  return size_ == other.size_ && std::equal(begin(), end(), other.begin());
+}
+
+bool relation_set::operator==(const type::relations& other) const {
+  return size_ == other.size() && std::equal(begin(), end(), other.begin());
+}
+
+// make_shared puts the reference counts next to the chunk
+std::size_t relation_set::chunk_footprint(const chunk& values) {
+  return 2 * sizeof(long) + sizeof(chunk) + memory::vector(values);
+}
+
+std::size_t relation_set::find_chunk(const type::relation& relation) const {
+  auto it = std::upper_bound(chunks_.begin(), chunks_.end(), relation, [] (const auto& relation, const auto& current) {
+    return relation < current->front();
+  });
+
+  return it == chunks_.begin() ? 0 : it - chunks_.begin() - 1;
+}
+
+relation_set::chunk& relation_set::own(std::size_t index) {
+  if (chunks_[index].use_count() != 1) {
+    chunks_[index] = std::make_shared<chunk>(*chunks_[index]);
+  } else {
+    // pairs with the release of the last other owner, whose reads of the chunk
+    // must happen before it is written in place
+    std::atomic_thread_fence(std::memory_order_acquire);
+  }
+
+  // every chunk is allocated mutable, only shared ones are treated as const
+  return const_cast<chunk&>(*chunks_[index]);
+}
+
+} /* namespace tp */
@@ -0,0 +1,386 @@
+#include <criteria.hpp>
+#include <engine.hpp>
+#include <isolation_bound.hpp>
+#include <population.hpp>
+#include <printer.hpp>
+#include <relation_set.hpp>
+#include <server.hpp>
+#include <settings.hpp>
+
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+#include <cerrno>
+#include <charconv>
+#include <chrono>
+#include <cstring>
+#include <functional>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <variant>
+#include <vector>
+
+namespace tp {
+
+namespace {
+
+class session_printer : public printer {
+  public:
+    session_printer(std::function<void(const std::string&)> send)
+      : printer(false, false, false), send_(send) {}
+
+    void finish() {
+      send_(best_cost_ ? "done " + std::to_string(best_cost_.value()) : "done -");
+    }
+
+    void print(unsigned int cost, const relation_set& isolations) override {
+      if (best_cost_ && cost >= best_cost_.value()) {
+        return;
+      }
+
+      best_cost_ = cost;
+
+      std::ostringstream line;
+      line << "solution " << cost;
+      for (const auto& [i, j] : isolations) {
+        line << " " << i << " " << j;
+      }
+
+      send_(line.str());
+    }
+  private:
+    std::function<void(const std::string&)> send_;
+    std::optional<unsigned int> best_cost_;
+};
+
+} /* namespace */
+
+class server::session {
+  public:
+    session(int fd) : fd_(fd) {}
+
+    ~session() {
+      cancel();
+      close(fd_);
+    }
+
+    int fd() const {
+      return fd_;
+    }
+
+    void send(const std::string& line) {
+      std::lock_guard<std::mutex> lock(write_mutex_);
+      std::string data = line + "\n";
+
+      for (std::size_t sent = 0; sent < data.size();) {
+        auto count = ::send(fd_, data.data() + sent, data.size() - sent, MSG_NOSIGNAL);
+        if (count <= 0) {
+          return;
+        }
+
+        sent += count;
+      }
+    }
+
+    bool solving() const {
+      return solving_;
+    }
+
+    void start(std::unique_ptr<engine>&& engine, std::unique_ptr<session_printer>&& printer,
+               std::unique_ptr<settings>&& settings, std::unique_ptr<criteria>&& criteria,
+               std::shared_ptr<const population> population) {
+      cancel();
+
+      printer_ = std::move(printer);
+      settings_ = std::move(settings);
+      criteria_ = std::move(criteria);
+      population_ = population;
+      engine_ = std::move(engine);
+      solving_ = true;
+
+      solver_ = std::thread([this] () {
+        engine_->run();
+        solving_ = false;
+        printer_->finish();
+      });
+    }
+
+    void cancel() {
+      if (engine_) {
+        engine_->stop();
+      }
+
+      if (solver_.joinable()) {
+        solver_.join();
+      }
+    }
+  private:
+    int fd_;
+    std::mutex write_mutex_;
+    std::atomic_bool solving_ = false;
+    std::thread solver_;
+
+    std::unique_ptr<session_printer> printer_;
+    std::unique_ptr<settings> settings_;
+    std::unique_ptr<criteria> criteria_;
+    std::shared_ptr<const population> population_;
+    std::unique_ptr<engine> engine_;
+};
+
+// the whole word must be a number below limit: std::stoul would accept a
+// sign and wrap "-1" around to the largest value
+static
+std::optional<unsigned int> parse_below(const std::string& word, unsigned long limit) {
+  unsigned long value;
+  auto [end, error] = std::from_chars(word.data(), word.data() + word.size(), value);
+  if (error != std::errc() || end != word.data() + word.size() || value >= limit) {
+    return {};
+  }
+
+  return value;
+}
+
+server::server(const settings& defaults, unsigned int chains)
+  : defaults_(defaults), chains_(chains), running_(false), listener_(-1) {}
+
+server::~server() {
+  close_clients();
+}
+
+std::optional<std::string> server::serve(const std::filesystem::path& path) {
+  sockaddr_un address{};
+  address.sun_family = AF_UNIX;
+  if (path.native().size() >= sizeof(address.sun_path)) {
+    return "socket path is too long";
+  }
+
+  std::strncpy(address.sun_path, path.c_str(), sizeof(address.sun_path) - 1);
+
+  int listener = socket(AF_UNIX, SOCK_STREAM, 0);
+  if (listener < 0) {
+    return strerror(errno);
+  }
+
+  unlink(path.c_str());
+  if (bind(listener, (sockaddr*) &address, sizeof(address)) < 0 || listen(listener, 16) < 0) {
+    std::string error = strerror(errno);
+    close(listener);
+    return error;
+  }
+
+  listener_ = listener;
+  running_ = true;
+
+  while (running_) {
+    int client = accept(listener, nullptr, nullptr);
+    if (client < 0) {
+      if (errno == EINTR) {
+        continue;
+      }
+
+      break;
+    }
+
+    reap();
+
+    auto& connection = clients_.emplace_back();
+    connection.state = std::make_unique<session>(client);
+    connection.thread = std::thread([this, &connection] () {
+      handle(*connection.state);
+      connection.done = true;
+    });
+  }
+
+  close_clients();
+  close(listener);
+  unlink(path.c_str());
+  return {};
+}
+
+void server::stop() {
+  running_ = false;
+
+  int listener = listener_.exchange(-1);
+  if (listener >= 0) {
+    shutdown(listener, SHUT_RDWR);
+  }
+}
+
+// joins the connections whose client has left
+void server::reap() {
+  for (auto it = clients_.begin(); it != clients_.end();) {
+    if (it->done) {
+      it->thread.join();
+      it = clients_.erase(it);
+    } else {
+      it++;
+    }
+  }
+}
+
+void server::close_clients() {
+  for (auto& connection : clients_) {
+    shutdown(connection.state->fd(), SHUT_RDWR);
+  }
+
+  // a connection thread only waits on its socket, so it returns once the
+  // command it is executing is answered, then its solve can be cancelled
+  for (auto& connection : clients_) {
+    connection.thread.join();
+    connection.state->cancel();
+  }
+
+  clients_.clear();
+}
+
+void server::handle(session& session) {
+  std::string buffer;
+  char data[4096];
+
+  while (true) {
+    auto count = read(session.fd(), data, sizeof(data));
+    if (count <= 0) {
+      return;
+    }
+
+    buffer.append(data, count);
+
+    std::size_t end;
+    while ((end = buffer.find('\n')) != std::string::npos) {
+      std::istringstream line(buffer.substr(0, end));
+      buffer.erase(0, end + 1);
+
+      std::vector<std::string> command;
+      for (std::string word; line >> word;) {
+        command.push_back(word);
+      }
+
+      if (command.empty()) {
+        continue;
+      }
+
+      if (command[0] == "quit") {
+        return;
+      }
+
+      auto reply = execute(session, command);
+      if (!reply.empty()) {
+        session.send(reply);
+      }
+    }
+  }
+}
+
+std::string server::execute(session& session, const std::vector<std::string>& command) {
+  const auto& name = command[0];
+
+  try {
+    if (name == "load" && command.size() == 3) {
+      auto population_file = population::from_file(command[2]);
+      if (population_file.index()) {
+        return "error " + std::get<std::string>(population_file);
+      }
+
+      std::lock_guard<std::mutex> lock(populations_mutex_);
+      populations_[command[1]] = std::make_shared<const population>(std::get<population>(population_file));
+      return "ok";
+    }
+
+    if (name == "infected" && command.size() >= 2) {
+      auto loaded = find(command[1]);
+      if (!loaded) {
+        return "error unknown population '" + command[1] + "'";
+      }
+
+      auto changed = std::make_shared<population>(loaded->size());
+      for (const auto& relation : loaded->relations()) {
+        changed->add_relation(relation);
+      }
+
+      for (std::size_t k = 2; k < command.size(); k++) {
+        auto person = parse_below(command[k], loaded->size());
+        if (!person) {
+          return "error person out of range";
+        }
+
+        changed->add_infected(person.value());
+      }
+
+      std::lock_guard<std::mutex> lock(populations_mutex_);
+      populations_[command[1]] = changed;
+      return "ok";
+    }
+
+    if (name == "solve" && (command.size() == 4 || command.size() == 5)) {
+      auto loaded = find(command[1]);
+      if (!loaded) {
+        return "error unknown population '" + command[1] + "'";
+      }
+
+      std::string engine_name = command.size() == 5 ? command[4] : "ga";
+      if (!engine::known(engine_name)) {
+        return "error unknown engine '" + engine_name + "'";
+      }
+
+      if (session.solving()) {
+        return "error already solving";
+      }
+
+      auto virality = parse_below(command[2], std::numeric_limits<unsigned int>::max());
+      if (!virality) {
+        return "error invalid virality";
+      }
+
+      auto solve_settings = std::make_unique<settings>(defaults_);
+      solve_settings->set_virality(virality.value());
+
+      auto bound = isolation_bound(*solve_settings, *loaded).compute();
+      if (!bound) {
+        return "error more than half of the population is already infected";
+      }
+
+      auto solve_criteria = std::make_unique<criteria>();
+      solve_criteria->set_time_limit(std::chrono::milliseconds((long long) (std::stof(command[3]) * 1000)));
+      solve_criteria->set_lower_bound(bound.value());
+
+      auto solve_printer = std::make_unique<session_printer>([&session] (const std::string& line) {
+        session.send(line);
+      });
+
+      auto solve_engine = engine::create(engine_name, *solve_printer, *solve_settings, *solve_criteria,
+                                         nullptr, *loaded, chains_, false);
+
+      session.send("ok");
+      session.start(std::move(solve_engine), std::move(solve_printer), std::move(solve_settings),
+                    std::move(solve_criteria), loaded);
+      return "";
+    }
+
+    if (name == "cancel" && command.size() == 1) {
+      session.cancel();
+      return "ok";
+    }
+  } catch (const std::logic_error& e) {
+    return "error invalid number";
+  }
+
+  return "error unknown command '" + name + "'";
+}
+
+std::shared_ptr<const population> server::find(const std::string& name) {
+  std::lock_guard<std::mutex> lock(populations_mutex_);
+  auto it = populations_.find(name);
+  if (it == populations_.end()) {
+    return nullptr;
+  }
+
+  return it->second;
+}
+
+} /* namespace tp */
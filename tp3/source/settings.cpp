@@ -1,5 +1,6 @@
 #include <settings.hpp>
 
+#include <mutex>
 #include <random>
 #include <utility>
 #include <vector>
@@ -10,19 +11,69 @@ settings::settings(unsigned int virality)
   : initial_isolation_factor_(0.5), chromosome_count_(10),
     virality_(virality),
     cross_count_(10), mutation_count_(100),
-    random_device_(), generator_(random_device_()), uniform_(0, 100) {}
+    mutation_add_max_(10), mutation_remove_max_(10), mutation_update_max_(10),
+    increase_add_max_(20), adaptive_(false),
+    random_device_(), batches_(0), generators_([this]() { return make_generator(); }) {}
+
+settings::settings(const settings& other)
+  : initial_isolation_factor_(other.initial_isolation_factor_), chromosome_count_(other.chromosome_count_),
+    virality_(other.virality_),
+    cross_count_(other.cross_count_), mutation_count_(other.mutation_count_),
+    mutation_add_max_(other.mutation_add_max_), mutation_remove_max_(other.mutation_remove_max_),
+    mutation_update_max_(other.mutation_update_max_),
+    increase_add_max_(other.increase_add_max_), adaptive_(other.adaptive_),
+    random_device_(), seed_(other.seed_), batches_(0), generators_([this]() { return make_generator(); }) {}
+
+settings::stream::stream(settings& settings, unsigned int batch, unsigned int index)
+  : settings_(settings) {
+
+  if (settings_.seed_) {
+    auto& generator = settings_.generator();
+    previous_ = generator;
+
+    std::seed_seq sequence{settings_.seed_.value(), batch, index};
+    generator.seed(sequence);
+  }
+}
+
+settings::stream::~stream() {
+  if (previous_) {
+    settings_.generator() = previous_.value();
+  }
+}
+
+// every thread starts from the seed alone, only the thread running the
+// sequential part of a search draws outside of a stream
+std::mt19937 settings::make_generator() {
+  std::lock_guard<std::mutex> lock(random_device_mutex_);
+  if (seed_) {
+    std::seed_seq sequence{seed_.value()};
+    return std::mt19937(sequence);
+  }
+
+  return std::mt19937(random_device_());
+}
+
+std::mt19937& settings::generator() {
+  return generators_.local();
+}
 
 bool settings::binary_random() {
-  return uniform_(generator_) % 2 == 0;
+  return random_to(100) % 2 == 0;
 }
 
 unsigned int settings::percent_random() {
-  return uniform_(generator_);
+  return random_to(100);
+}
+
+float settings::unit_random() {
+  std::uniform_real_distribution<float> uniform(0, 1);
+  return uniform(generator());
 }
 
 unsigned int settings::random_to(unsigned int upper) {
   std::uniform_int_distribution<unsigned int> uniform(0, upper);
-  return uniform(generator_);
+  return uniform(generator());
 }
 
 std::pair<unsigned int, unsigned int> settings::random_pair(unsigned max) {
@@ -55,4 +106,67 @@ unsigned int settings::mutation_count() const {
   return mutation_count_;
 }
 
+unsigned int settings::mutation_add_max() const {
+  return mutation_add_max_;
+}
+
+unsigned int settings::mutation_remove_max() const {
+  return mutation_remove_max_;
+}
+
+unsigned int settings::mutation_update_max() const {
+  return mutation_update_max_;
+}
+
+unsigned int settings::increase_add_max() const {
+  return increase_add_max_;
+}
+
+bool settings::adaptive() const {
+  return adaptive_;
+}
+
+void settings::set_virality(unsigned int virality) {
+  virality_ = virality;
+}
+
+void settings::set_chromosome_count(unsigned int count) {
+  chromosome_count_ = count;
+}
+
+void settings::set_cross_count(unsigned int count) {
+  cross_count_ = count;
+}
+
+void settings::set_mutation_count(unsigned int count) {
+  mutation_count_ = count;
+}
+
+void settings::set_mutation_max(unsigned int add, unsigned int remove, unsigned int update) {
+  mutation_add_max_ = add;
+  mutation_remove_max_ = remove;
+  mutation_update_max_ = update;
+}
+
+void settings::set_increase_add_max(unsigned int add) {
+  increase_add_max_ = add;
+}
+
+void settings::set_seed(unsigned int seed) {
+  std::lock_guard<std::mutex> lock(random_device_mutex_);
+  seed_ = seed;
+  batches_ = 0;
+  generators_.clear();
+}
+
+// called from sequential code only, so batches are numbered the same way in
+// every seeded run
+unsigned int settings::next_batch() {
+  return batches_++;
+}
+
+void settings::set_adaptive(bool adaptive) {
+  adaptive_ = adaptive;
+}
+
 } /* namespace tp */
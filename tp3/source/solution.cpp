@@ -0,0 +1,111 @@
+#include <contagion.hpp>
+#include <solution.hpp>
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <limits>
+#include <sstream>
+#include <string>
+#include <variant>
+#include <vector>
+
+namespace tp {
+
+solution::solution(std::vector<type::relation>&& isolations) : isolations_(std::move(isolations)) {}
+
+std::variant<solution, std::string> solution::from_file(const std::filesystem::path& path) {
+  std::ifstream file(path, std::ifstream::in);
+  if (file.fail()) {
+    return strerror(errno);
+  }
+
+  return parse(file);
+}
+
+std::variant<solution, std::string> solution::parse(std::istream& input) {
+  std::vector<type::relation> isolations;
+  bool separated = false;
+  std::string line;
+
+  for (unsigned int number = 1; std::getline(input, line); number++) {
+    std::istringstream fields(line);
+    long long i, j;
+    std::string rest;
+
+    if (!(fields >> i)) {
+      if (line.find_first_not_of(" \t\r") != std::string::npos) {
+        return "line " + std::to_string(number) + ": expected 'i j'";
+      }
+
+      separated = true;
+      continue;
+    }
+
+    if (!(fields >> j) || (fields >> rest) || i < 0 || j < 0) {
+      return "line " + std::to_string(number) + ": expected 'i j'";
+    }
+
+    if (i > std::numeric_limits<type::person>::max() || j > std::numeric_limits<type::person>::max()) {
+      return "line " + std::to_string(number) + ": person out of range";
+    }
+
+    if (separated) {
+      isolations.clear();
+      separated = false;
+    }
+
+    isolations.emplace_back(i, j);
+  }
+
+  return solution(std::move(isolations));
+}
+
+const std::vector<type::relation>& solution::isolations() const {
+  return isolations_;
+}
+
+type::relations solution::relations() const {
+  type::relations relations;
+  for (auto [i, j] : isolations_) {
+    relations.emplace(std::min(i, j), std::max(i, j));
+  }
+
+  return relations;
+}
+
+type::verdict solution::verify(const contagion& contagion, unsigned int virality) const {
+  type::verdict verdict;
+  verdict.cost = isolations_.size();
+
+  std::vector<bool> isolated(contagion.relation_count(), false);
+  for (auto [i, j] : isolations_) {
+    auto id = contagion.relation_id({std::min(i, j), std::max(i, j)});
+    if (!id) {
+      verdict.reason = "relation (" + std::to_string(i) + ", " + std::to_string(j) + ") does not exist";
+      return verdict;
+    }
+
+    // the grading script removes each isolated relation from the graph, so a
+    // second line for the same relation finds it missing
+    if (isolated[id.value()]) {
+      verdict.reason = "relation (" + std::to_string(i) + ", " + std::to_string(j) + ") is isolated twice";
+      return verdict;
+    }
+
+    isolated[id.value()] = true;
+  }
+
+  auto infected = contagion.run(virality, isolated);
+  verdict.infected_percent = contagion.percent(infected);
+  verdict.valid = infected <= contagion.size() / 2;
+  if (!verdict.valid) {
+    verdict.reason = "more than half of the population is infected";
+  }
+
+  return verdict;
+}
+
+} /* namespace tp */
@@ -0,0 +1,123 @@
+#include <relation_set.hpp>
+#include <solution_sink.hpp>
+
+#include <cerrno>
+#include <charconv>
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <system_error>
+#include <utility>
+
+namespace tp {
+
+solution_sink::solution_sink(const std::filesystem::path& path)
+  : path_(path), thread_([this] { run(); }) {}
+
+solution_sink::~solution_sink() {
+  close();
+}
+
+// a pending solution replaced by this one is released once the lock is, as
+// freeing its last chunks may take a while
+void solution_sink::submit(unsigned int cost, const relation_set& isolations) {
+  std::optional<std::pair<unsigned int, relation_set>> submitted(std::in_place, cost, isolations);
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    pending_.swap(submitted);
+  }
+
+  wake_.notify_one();
+}
+
+std::optional<std::string> solution_sink::close() {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    closing_ = true;
+  }
+
+  wake_.notify_one();
+  if (thread_.joinable()) {
+    thread_.join();
+  }
+
+  std::lock_guard<std::mutex> lock(mutex_);
+  return error_;
+}
+
+unsigned int solution_sink::written() const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return written_;
+}
+
+std::string solution_sink::format(const relation_set& isolations) {
+  // two persons of at most ten digits, a space and a newline per isolation
+  std::string output(isolations.size() * 22, '\0');
+  char* current = output.data();
+  char* end = current + output.size();
+
+  for (const auto& [i, j] : isolations) {
+    current = std::to_chars(current, end, i).ptr;
+    *current++ = ' ';
+    current = std::to_chars(current, end, j).ptr;
+    *current++ = '\n';
+  }
+
+  output.resize(current - output.data());
+  return output;
+}
+
+void solution_sink::run() {
+  std::unique_lock<std::mutex> lock(mutex_);
+
+  while (true) {
+    wake_.wait(lock, [this] { return pending_ || closing_; });
+    if (!pending_) {
+      return;
+    }
+
+    auto [cost, isolations] = std::move(pending_.value());
+    pending_.reset();
+
+    // solutions submitted during the write coalesce into the pending one
+    lock.unlock();
+    auto error = write(isolations);
+    lock.lock();
+
+    if (error) {
+      error_ = error;
+    } else {
+      written_++;
+    }
+  }
+}
+
+std::optional<std::string> solution_sink::write(const relation_set& isolations) const {
+  auto temporary = path_;
+  temporary += ".tmp";
+
+  FILE* file = fopen(temporary.c_str(), "w");
+  if (file == nullptr) {
+    return strerror(errno);
+  }
+
+  auto output = format(isolations);
+  bool failed = fwrite(output.data(), 1, output.size(), file) != output.size();
+  failed |= fclose(file) != 0;
+  if (failed) {
+    return strerror(errno);
+  }
+
+  std::error_code error;
+  std::filesystem::rename(temporary, path_, error);
+  if (error) {
+    return error.message();
+  }
+
+  return {};
+}
+
+} /* namespace tp */
@@ -0,0 +1,95 @@
+#include <statistics.hpp>
+
+#include <algorithm>
+#include <cerrno>
+#include <chrono>
+#include <cstddef>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <variant>
+#include <vector>
+
+namespace tp {
+
+statistics::statistics(std::ofstream&& file) : file_(std::move(file)) {}
+
+std::variant<statistics, std::string> statistics::from_file(const std::filesystem::path& path) {
+  std::ofstream file(path, std::ofstream::out | std::ofstream::trunc);
+  if (file.fail()) {
+    return strerror(errno);
+  }
+
+  file << "generation,elapsed_us,mutate_us,cross_us,evaluate_us,"
+       << "crosses,mutations,evaluations,evaluations_per_second,invalid_ratio,"
+       << "cached,inferred,aborted,chromosomes,"
+       << "diversity,allocations,allocated_bytes,isolation_bytes,isolation_bytes_per_chromosome,"
+       << "peak_rss_kb,best_cost" << std::endl;
+
+  return statistics(std::move(file));
+}
+
+float statistics::diversity(const std::vector<const relation_set*>& isolations) {
+  if (isolations.size() < 2) {
+    return 0;
+  }
+
+  float total = 0;
+  unsigned int pairs = 0;
+
+  for (std::size_t i = 0; i < isolations.size(); i++) {
+    for (auto j = i + 1; j < isolations.size(); j++) {
+      const auto& a = *isolations[i];
+      const auto& b = *isolations[j];
+
+      std::vector<type::relation> common;
+      std::set_intersection(a.begin(), a.end(), b.begin(), b.end(), std::back_inserter(common));
+
+      auto unified = a.size() + b.size() - common.size();
+      if (unified != 0) {
+        total += 1 - ((float) common.size()) / ((float) unified);
+      }
+
+      pairs++;
+    }
+  }
+
+  return total / pairs;
+}
+
+void statistics::record(const type::generation_stats& stats) {
+  float evaluate_seconds = stats.evaluate.count() / 1e6;
+  float evaluations_per_second = evaluate_seconds > 0 ? stats.evaluations / evaluate_seconds : 0;
+  float invalid_ratio = stats.evaluations > 0 ? ((float) stats.invalids) / stats.evaluations : 0;
+  float isolation_bytes_per_chromosome = stats.chromosomes > 0 ? ((float) stats.isolation_bytes) / stats.chromosomes : 0;
+
+  file_ << stats.generation << ","
+        << stats.elapsed.count() << ","
+        << stats.mutate.count() << ","
+        << stats.cross.count() << ","
+        << stats.evaluate.count() << ","
+        << stats.crosses << ","
+        << stats.mutations << ","
+        << stats.evaluations << ","
+        << evaluations_per_second << ","
+        << invalid_ratio << ","
+        << stats.cached << ","
+        << stats.inferred << ","
+        << stats.aborted << ","
+        << stats.chromosomes << ","
+        << stats.diversity << ","
+        << stats.allocations << ","
+        << stats.allocated_bytes << ","
+        << stats.isolation_bytes << ","
+        << isolation_bytes_per_chromosome << ","
+        << stats.peak_rss / 1024 << ",";
+
+  if (stats.best_cost) {
+    file_ << stats.best_cost.value();
+  }
+
+  file_ << "\n";
+}
+
+} /* namespace tp */
@@ -0,0 +1,53 @@
+#include <thread_pinning.hpp>
+
+#include <pthread.h>
+#include <sched.h>
+
+#include <vector>
+
+namespace tp {
+
+thread_pinning::thread_pinning() : next_(0) {
+  cpu_set_t allowed;
+  CPU_ZERO(&allowed);
+
+  if (sched_getaffinity(0, sizeof(allowed), &allowed) == 0) {
+    cores_ = cores(allowed);
+  }
+
+  observe(true);
+}
+
+thread_pinning::~thread_pinning() {
+  observe(false);
+}
+
+unsigned int thread_pinning::core_count() const {
+  return cores_.size();
+}
+
+void thread_pinning::on_scheduler_entry(bool) {
+  thread_local bool pinned = false;
+  if (pinned || cores_.empty()) {
+    return;
+  }
+
+  cpu_set_t core;
+  CPU_ZERO(&core);
+  CPU_SET(cores_[next_++ % cores_.size()], &core);
+
+  pinned = pthread_setaffinity_np(pthread_self(), sizeof(core), &core) == 0;
+}
+
+std::vector<int> thread_pinning::cores(const cpu_set_t& set) {
+  std::vector<int> cores;
+  for (int core = 0; core < CPU_SETSIZE; core++) {
+    if (CPU_ISSET(core, &set)) {
+      cores.push_back(core);
+    }
+  }
+
+  return cores;
+}
+
+} /* namespace tp */
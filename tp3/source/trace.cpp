@@ -0,0 +1,98 @@
+#include <trace.hpp>
+
+#include <atomic>
+#include <cerrno>
+#include <chrono>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <vector>
+
+namespace tp::trace {
+
+std::atomic_bool enabled_(false);
+
+namespace {
+
+struct event {
+  const char* name;
+  std::chrono::steady_clock::time_point start;
+  std::chrono::steady_clock::time_point end;
+};
+
+struct buffer {
+  unsigned int thread;
+  std::vector<event> events;
+};
+
+std::chrono::steady_clock::time_point origin;
+std::mutex buffers_mutex;
+std::vector<std::unique_ptr<buffer>> buffers;
+
+buffer& thread_buffer() {
+  thread_local buffer* local = nullptr;
+  if (local == nullptr) {
+    std::lock_guard<std::mutex> lock(buffers_mutex);
+    buffers.push_back(std::make_unique<buffer>());
+    local = buffers.back().get();
+    local->thread = buffers.size();
+    local->events.reserve(4096);
+  }
+
+  return *local;
+}
+
+} /* namespace */
+
+void enable() {
+  origin = std::chrono::steady_clock::now();
+  enabled_ = true;
+}
+
+void span::record() const {
+  thread_buffer().events.push_back({name_, start_, std::chrono::steady_clock::now()});
+}
+
+std::optional<std::string> write(const std::filesystem::path& path) {
+  enabled_ = false;
+
+  std::ofstream file(path, std::ofstream::out | std::ofstream::trunc);
+  if (file.fail()) {
+    return strerror(errno);
+  }
+
+  using std::chrono::duration_cast;
+  using std::chrono::microseconds;
+
+  std::lock_guard<std::mutex> lock(buffers_mutex);
+
+  bool first = true;
+  file << "{\"traceEvents\":[";
+  for (const auto& buffer : buffers) {
+    for (const auto& event : buffer->events) {
+      if (!first) {
+        file << ",";
+      }
+
+      first = false;
+      file << "\n{\"name\":\"" << event.name << "\",\"ph\":\"X\",\"pid\":1"
+           << ",\"tid\":" << buffer->thread
+           << ",\"ts\":" << duration_cast<microseconds>(event.start - origin).count()
+           << ",\"dur\":" << duration_cast<microseconds>(event.end - event.start).count()
+           << "}";
+    }
+  }
+  file << "\n],\"displayTimeUnit\":\"ms\"}\n";
+
+  if (file.fail()) {
+    return strerror(errno);
+  }
+
+  return {};
+}
+
+} /* namespace tp::trace */
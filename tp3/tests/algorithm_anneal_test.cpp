@@ -0,0 +1,65 @@
+#include <catch.hpp>
+#include <algorithm_anneal.hpp>
+#include <criteria.hpp>
+#include <population.hpp>
+#include <printer.hpp>
+#include <relation_set.hpp>
+#include <settings.hpp>
+
+#include <optional>
+
+namespace tp {
+
+class mock_printer : public printer {
+  public:
+    mock_printer(): printer(false, false, false) { }
+
+    void print(unsigned int cost, const relation_set& isolations) override {
+      last_cost = cost;
+      last_isolations = isolations.relations();
+    }
+
+    std::optional<unsigned int> last_cost;
+    type::relations last_isolations;
+};
+
+} // namespace tp
+
+static
+tp::population create_population() {
+  tp::population pop(6);
+
+  pop.add_infected(0);
+  pop.add_infected(1);
+
+  pop.add_relation({0, 2});
+  pop.add_relation({0, 3});
+  pop.add_relation({1, 2});
+  pop.add_relation({1, 5});
+  pop.add_relation({2, 3});
+  pop.add_relation({2, 4});
+  pop.add_relation({3, 4});
+  pop.add_relation({3, 5});
+
+  return pop;
+}
+
+TEST_CASE("Anneal and tabu engines print valid solutions") {
+  tp::population population = create_population();
+
+  for (auto mode : {tp::algorithm_anneal::mode::anneal, tp::algorithm_anneal::mode::tabu}) {
+    for (unsigned int virality = 1; virality < 4; virality++) {
+      tp::mock_printer printer;
+      tp::settings settings(virality);
+      tp::criteria criteria;
+      criteria.set_max_generations(5);
+
+      tp::algorithm_anneal algorithm_anneal(printer, settings, criteria, population, mode, 2);
+      algorithm_anneal.run();
+
+      REQUIRE(printer.last_cost);
+      REQUIRE(printer.last_cost.value() == printer.last_isolations.size());
+      REQUIRE(population.run(virality, printer.last_isolations) <= 50);
+    }
+  }
+}
@@ -0,0 +1,83 @@
+#include <catch.hpp>
+#include <algorithm_components.hpp>
+#include <criteria.hpp>
+#include <population.hpp>
+#include <printer.hpp>
+#include <settings.hpp>
+
+#include <chrono>
+
+static
+tp::population create_population() {
+  tp::population pop(13);
+
+  for (unsigned int offset : {0, 6}) {
+    pop.add_infected(offset + 0);
+    pop.add_infected(offset + 1);
+
+    pop.add_relation({offset + 0, offset + 2});
+    pop.add_relation({offset + 0, offset + 3});
+    pop.add_relation({offset + 1, offset + 2});
+    pop.add_relation({offset + 1, offset + 5});
+    pop.add_relation({offset + 2, offset + 3});
+    pop.add_relation({offset + 2, offset + 4});
+    pop.add_relation({offset + 3, offset + 4});
+    pop.add_relation({offset + 3, offset + 5});
+  }
+
+  return pop;
+}
+
+TEST_CASE("Components are split from the relations") {
+  tp::population population = create_population();
+  tp::printer printer(false, false, false);
+  tp::settings settings(2);
+  tp::algorithm_components algorithm_components(printer, settings, population);
+
+  const auto& components = algorithm_components.components();
+  REQUIRE(components.size() == 3);
+  REQUIRE(components[0] == tp::type::component{0, 1, 2, 3, 4, 5});
+  REQUIRE(components[1] == tp::type::component{6, 7, 8, 9, 10, 11});
+  REQUIRE(components[2] == tp::type::component{12});
+}
+
+TEST_CASE("Components solution stays under half infected") {
+  tp::population population = create_population();
+  tp::printer printer(false, false, false);
+
+  for (unsigned int virality = 1; virality < 4; virality++) {
+    tp::settings settings(virality);
+    tp::algorithm_components algorithm_components(printer, settings, population);
+
+    auto isolations = algorithm_components.solve();
+    REQUIRE(isolations);
+    REQUIRE(population.run(virality, isolations.value()) <= 50);
+  }
+}
+
+TEST_CASE("Components share the infection budget") {
+  tp::population population = create_population();
+  tp::printer printer(false, false, false);
+  tp::settings settings(2);
+  tp::algorithm_components algorithm_components(printer, settings, population);
+
+  // 6 of the 13 people may be infected, a component left alone infects all
+  // its 6 people so each one needs an isolation
+  auto isolations = algorithm_components.solve();
+  REQUIRE(isolations);
+  REQUIRE(isolations->size() == 2);
+  REQUIRE(population.run(2, isolations.value()) <= 50);
+}
+
+TEST_CASE("Components stop on their criteria") {
+  tp::population population = create_population();
+  tp::printer printer(false, false, false);
+  tp::settings settings(2);
+  tp::criteria criteria;
+  criteria.set_time_limit(std::chrono::milliseconds(0));
+  tp::algorithm_components algorithm_components(printer, settings, population, &criteria);
+
+  // no curve point is computed, and no component left alone fits the budget
+  algorithm_components.run();
+  REQUIRE(!printer.printed());
+}
@@ -0,0 +1,63 @@
+#include <catch.hpp>
+#include <algorithm_greedy.hpp>
+#include <criteria.hpp>
+#include <population.hpp>
+#include <printer.hpp>
+#include <settings.hpp>
+
+#include <chrono>
+
+static
+tp::population create_population() {
+  tp::population pop(6);
+
+  pop.add_infected(0);
+  pop.add_infected(1);
+
+  pop.add_relation({0, 2});
+  pop.add_relation({0, 3});
+  pop.add_relation({1, 2});
+  pop.add_relation({1, 5});
+  pop.add_relation({2, 3});
+  pop.add_relation({2, 4});
+  pop.add_relation({3, 4});
+  pop.add_relation({3, 5});
+
+  return pop;
+}
+
+TEST_CASE("Greedy algorithm returns a valid solution") {
+  tp::population population = create_population();
+  tp::printer printer(false, false, false);
+
+  for (unsigned int virality = 1; virality < 4; virality++) {
+    tp::settings settings(virality);
+    tp::algorithm_greedy algorithm_greedy(printer, settings, population);
+
+    auto isolations = algorithm_greedy.solve();
+    REQUIRE(population.run(virality, isolations) <= 50);
+  }
+}
+
+TEST_CASE("Greedy algorithm prunes useless isolations") {
+  tp::population population = create_population();
+  tp::printer printer(false, false, false);
+  tp::settings settings(2);
+  tp::algorithm_greedy algorithm_greedy(printer, settings, population);
+
+  auto isolations = algorithm_greedy.solve();
+  REQUIRE(isolations.size() == 1);
+  REQUIRE(population.run(2, isolations) <= 50);
+}
+
+TEST_CASE("Greedy algorithm stops on its criteria") {
+  tp::population population = create_population();
+  tp::printer printer(false, false, false);
+  tp::settings settings(1);
+  tp::criteria criteria;
+  criteria.set_time_limit(std::chrono::milliseconds(0));
+  tp::algorithm_greedy algorithm_greedy(printer, settings, population, &criteria);
+
+  algorithm_greedy.run();
+  REQUIRE(!printer.printed());
+}
@@ -0,0 +1,75 @@
+#include <catch.hpp>
+#include <algorithm.hpp>
+#include <criteria.hpp>
+#include <population.hpp>
+#include <printer.hpp>
+#include <settings.hpp>
+
+#include <vector>
+
+static
+tp::population create_population() {
+  tp::population pop(6);
+
+  pop.add_infected(0);
+  pop.add_infected(1);
+
+  pop.add_relation({0, 2});
+  pop.add_relation({0, 3});
+  pop.add_relation({1, 2});
+  pop.add_relation({1, 5});
+  pop.add_relation({2, 3});
+  pop.add_relation({2, 4});
+  pop.add_relation({3, 4});
+  pop.add_relation({3, 5});
+
+  return pop;
+}
+
+// runs no generation, so the chromosomes are the seeded ones
+static
+std::vector<tp::type::relations> seed(tp::settings& settings, const tp::population& population,
+                                      const tp::type::relations& injected) {
+  tp::printer printer(false, false, false);
+  tp::criteria criteria;
+  criteria.set_max_generations(0);
+
+  tp::algorithm algorithm(printer, settings, criteria, nullptr, population);
+  algorithm.inject(injected);
+  algorithm.run();
+
+  std::vector<tp::type::relations> seeded;
+  for (auto chromosome : algorithm.chromosomes()) {
+    seeded.push_back(chromosome->isolations().relations());
+  }
+
+  return seeded;
+}
+
+TEST_CASE("Injected solutions seed the population with their variants") {
+  tp::population population = create_population();
+  tp::type::relations injected{{0, 2}, {0, 3}, {1, 2}, {1, 5}};
+
+  tp::settings settings(1);
+  settings.set_chromosome_count(10);
+  auto seeded = seed(settings, population, injected);
+
+  // the injected solution, then its 2 variants, then the random seeds
+  REQUIRE(seeded.size() >= 3);
+  REQUIRE(seeded.size() <= 10);
+  REQUIRE(seeded[0] == injected);
+  REQUIRE(seeded[1] != injected);
+  REQUIRE(seeded[2] != injected);
+}
+
+TEST_CASE("Injected variants stay within the chromosome count") {
+  tp::population population = create_population();
+  tp::type::relations injected{{0, 2}, {0, 3}, {1, 2}, {1, 5}};
+
+  tp::settings settings(1);
+  settings.set_chromosome_count(2);
+  auto seeded = seed(settings, population, injected);
+
+  REQUIRE(seeded.size() == 2);
+  REQUIRE(seeded[0] == injected);
+}
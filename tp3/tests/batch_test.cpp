@@ -0,0 +1,54 @@
+#include <catch.hpp>
+#include <batch.hpp>
+
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <variant>
+
+static
+std::filesystem::path write_batch(const std::string& content) {
+  auto path = std::filesystem::temp_directory_path() / "pandemic_batch_test.txt";
+  std::ofstream file(path, std::ofstream::out | std::ofstream::trunc);
+  file << content;
+  return path;
+}
+
+TEST_CASE("Batch jobs are read from a file") {
+  auto path = write_batch(
+    "# dataset virality seed seconds\n"
+    "a.txt 3 1 2\n"
+    "\n"
+    "b.txt 1 1 0.5\n"
+    "a.txt 1 1 2\n"
+    "a.txt 2 1 2\n"
+    "a.txt 2 7 2\n"
+  );
+
+  auto batch_file = tp::batch::from_file(path);
+  REQUIRE(batch_file.index() == 0);
+
+  const auto& batch = std::get<tp::batch>(batch_file);
+  REQUIRE(batch.jobs().size() == 5);
+  REQUIRE(batch.jobs()[1].dataset == "b.txt");
+  REQUIRE(batch.jobs()[1].seconds == 0.5);
+  REQUIRE(batch.datasets() == std::vector<std::string>{"a.txt", "b.txt"});
+
+  auto chains = batch.chains();
+  REQUIRE(chains.size() == 3);
+  REQUIRE(chains[0] == std::vector<std::size_t>{2, 3, 0});
+  REQUIRE(chains[1] == std::vector<std::size_t>{4});
+  REQUIRE(chains[2] == std::vector<std::size_t>{1});
+
+  std::filesystem::remove(path);
+}
+
+TEST_CASE("Batch file errors give the line") {
+  auto path = write_batch("a.txt 3 1 2\na.txt 3 x 2\n");
+
+  auto batch_file = tp::batch::from_file(path);
+  REQUIRE(batch_file.index() == 1);
+  REQUIRE(std::get<std::string>(batch_file).starts_with("line 2:"));
+
+  std::filesystem::remove(path);
+}
@@ -0,0 +1,55 @@
+#include <catch.hpp>
+#include <benchmark.hpp>
+#include <population.hpp>
+
+#include <filesystem>
+#include <random>
+#include <variant>
+#include <vector>
+
+TEST_CASE("Benchmark results are read back from their JSON line") {
+  tp::type::bench_result result{"contagion_run", "medium", 1200, 35000.5, 28571.4, 3.25};
+
+  auto line = tp::benchmark::to_json(result);
+  REQUIRE(line == "{\"benchmark\":\"contagion_run\",\"scale\":\"medium\",\"ops\":1200,\"ns_per_op\":35000.5,"
+                  "\"evaluations_per_second\":28571.4,\"allocations_per_op\":3.25}");
+
+  auto parsed = tp::benchmark::from_json(line);
+  REQUIRE(parsed);
+  REQUIRE(parsed->benchmark == "contagion_run");
+  REQUIRE(parsed->scale == "medium");
+  REQUIRE(parsed->ops == 1200);
+  REQUIRE(parsed->ns_per_op == Approx(35000.5));
+  REQUIRE(parsed->allocations_per_op == Approx(3.25));
+
+  REQUIRE(!tp::benchmark::from_json("{\"benchmark\":\"contagion_run\"}"));
+}
+
+TEST_CASE("Benchmarks are compared with their baseline") {
+  std::vector<tp::type::bench_result> baseline{
+    {"contagion_run", "small", 10, 1000, 0, 0},
+    {"contagion_run", "medium", 10, 4000, 0, 0},
+  };
+
+  REQUIRE(tp::benchmark::slowdown({"contagion_run", "medium", 10, 5000, 0, 0}, baseline) == Approx(1.25));
+  REQUIRE(tp::benchmark::slowdown({"contagion_run", "small", 10, 500, 0, 0}, baseline) == Approx(0.5));
+  REQUIRE(!tp::benchmark::slowdown({"contagion_run", "large", 10, 500, 0, 0}, baseline));
+}
+
+TEST_CASE("Generated benchmark populations are written as datasets") {
+  std::mt19937 generator(1);
+  tp::type::bench_scale scale{"tiny", 50, 120, 20};
+  tp::population population = tp::benchmark::generate(scale, generator);
+
+  REQUIRE(population.relations().size() == 120);
+  REQUIRE(population.infected().size() == 10);
+
+  auto path = std::filesystem::temp_directory_path() / "pandemic_benchmark_test.txt";
+  REQUIRE(!tp::benchmark::write(population, path));
+
+  auto loaded = tp::population::from_file(path);
+  std::filesystem::remove(path);
+  REQUIRE(loaded.index() == 0);
+  REQUIRE(std::get<tp::population>(loaded).relations() == population.relations());
+  REQUIRE(std::get<tp::population>(loaded).infected() == population.infected());
+}
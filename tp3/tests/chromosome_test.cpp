@@ -1,5 +1,6 @@
 #include <catch.hpp>
 #include <chromosome.hpp>
+#include <contagion.hpp>
 #include <population.hpp>
 #include <settings.hpp>
 
@@ -82,3 +83,83 @@ TEST_CASE("Cost of chromosome is correctly computed") {
   tp::chromosome c6(settings, population, i6);
   REQUIRE(c6.cost() == 5);
 }
+
+TEST_CASE("Chromosome moves can be undone") {
+  tp::population population = create_population();
+  tp::mock_settings settings;
+
+  std::set<std::pair<unsigned int, unsigned int>> isolations{{2, 3}, {3, 4}, {3, 5}};
+  tp::chromosome chromosome(settings, population, isolations);
+
+  auto added = chromosome.add_isolation();
+  REQUIRE(added.added);
+  REQUIRE(!added.removed);
+  REQUIRE(chromosome.isolations().size() == 4);
+  chromosome.undo(added);
+  REQUIRE(chromosome.isolations() == isolations);
+
+  auto removed = chromosome.remove_isolation();
+  REQUIRE(removed.removed);
+  REQUIRE(chromosome.isolations().size() == 2);
+  chromosome.undo(removed);
+  REQUIRE(chromosome.isolations() == isolations);
+
+  auto updated = chromosome.update_isolation();
+  chromosome.undo(updated);
+  REQUIRE(chromosome.isolations() == isolations);
+  chromosome.apply(updated);
+  chromosome.undo(updated);
+  REQUIRE(chromosome.isolations() == isolations);
+}
+
+TEST_CASE("Isolations are added until every relation is isolated") {
+  tp::population population = create_population();
+  tp::mock_settings settings;
+  tp::chromosome chromosome(settings, population, tp::type::relations{});
+
+  for (std::size_t i = 0; i < population.relations().size(); i++) {
+    auto added = chromosome.add_isolation();
+    REQUIRE(added.added);
+    REQUIRE(population.relations().contains(added.added.value()));
+  }
+
+  REQUIRE(chromosome.isolations() == population.relations());
+  REQUIRE(!chromosome.add_isolation().added);
+}
+
+TEST_CASE("Chromosome evaluations are screened") {
+  tp::population population = create_population();
+  tp::contagion contagion(population);
+  tp::mock_settings settings;
+
+  std::set<std::pair<unsigned int, unsigned int>> valid{{2, 3}, {3, 4}, {3, 5}};
+  tp::chromosome chromosome(settings, population, valid);
+
+  auto simulated = chromosome.evaluate(contagion);
+  REQUIRE(simulated.cost == 3);
+  REQUIRE(simulated.stage == tp::type::screening::simulated);
+
+  auto cached = chromosome.evaluate(contagion);
+  REQUIRE(cached.cost == 3);
+  REQUIRE(cached.stage == tp::type::screening::cached);
+
+  tp::chromosome* added = chromosome.mutate(1, 0, 0);
+  auto inferred = added->evaluate(contagion);
+  REQUIRE(inferred.cost == 4);
+  REQUIRE(inferred.stage == tp::type::screening::inferred);
+  REQUIRE(added->evaluate(contagion).stage == tp::type::screening::cached);
+  delete added;
+
+  tp::chromosome* removed = chromosome.mutate(0, 1, 0);
+  REQUIRE(removed->evaluate(contagion).stage != tp::type::screening::inferred);
+  delete removed;
+
+  std::set<std::pair<unsigned int, unsigned int>> invalid{{3, 5}};
+  tp::chromosome infeasible(settings, population, invalid);
+  auto aborted = infeasible.evaluate(contagion);
+  REQUIRE(aborted.cost == std::nullopt);
+  REQUIRE(aborted.stage == tp::type::screening::aborted);
+
+  chromosome.undo(chromosome.remove_isolation());
+  REQUIRE(chromosome.evaluate(contagion).stage != tp::type::screening::cached);
+}
@@ -0,0 +1,170 @@
+#include <catch.hpp>
+#include <contagion.hpp>
+#include <population.hpp>
+
+#include <algorithm>
+#include <random>
+#include <vector>
+
+static
+tp::population create_population() {
+  tp::population pop(6);
+
+  pop.add_infected(0);
+  pop.add_infected(1);
+
+  pop.add_relation({0, 2});
+  pop.add_relation({0, 3});
+  pop.add_relation({1, 2});
+  pop.add_relation({1, 5});
+  pop.add_relation({2, 3});
+  pop.add_relation({2, 4});
+  pop.add_relation({3, 4});
+  pop.add_relation({3, 5});
+
+  return pop;
+}
+
+TEST_CASE("Contagion numbers relations in sorted order") {
+  tp::population population = create_population();
+  tp::contagion contagion(population);
+
+  REQUIRE(contagion.relation_count() == 8);
+  REQUIRE(contagion.relation_id({0, 2}) == 0);
+  REQUIRE(contagion.relation_id({3, 5}) == 7);
+  REQUIRE(contagion.relation_id({4, 5}) == std::nullopt);
+  REQUIRE(contagion.relation(3) == tp::type::relation{1, 5});
+}
+
+TEST_CASE("Contagion propagates like the population") {
+  tp::population population = create_population();
+  tp::contagion contagion(population);
+
+  std::vector<tp::type::relations> isolations{
+    {}, {{3, 5}}, {{3, 4}, {3, 5}}, {{2, 3}, {3, 4}, {3, 5}}, {{0, 2}, {1, 2}},
+  };
+
+  for (unsigned int virality = 0; virality < 4; virality++) {
+    for (const auto& isolation : isolations) {
+      auto infected = contagion.run(virality, isolation);
+      REQUIRE(contagion.percent(infected) == population.run(virality, isolation));
+    }
+  }
+}
+
+TEST_CASE("Dense contagion propagates like the population") {
+  tp::population population = create_population();
+  tp::contagion contagion(population, tp::contagion::backend::dense);
+  REQUIRE(contagion.dense());
+
+  std::vector<tp::type::relations> isolations{
+    {}, {{3, 5}}, {{3, 4}, {3, 5}}, {{2, 3}, {3, 4}, {3, 5}}, {{0, 2}, {1, 2}},
+  };
+
+  for (unsigned int virality = 0; virality < 4; virality++) {
+    for (const auto& isolation : isolations) {
+      auto infected = contagion.run(virality, isolation);
+      REQUIRE(contagion.percent(infected) == population.run(virality, isolation));
+    }
+  }
+}
+
+TEST_CASE("Contagion records the round of each infection") {
+  tp::population population = create_population();
+  tp::contagion contagion(population);
+
+  std::vector<unsigned int> rounds;
+  REQUIRE(contagion.run(2, std::vector<bool>(8, false), &rounds) == 6);
+  REQUIRE(rounds == std::vector<unsigned int>{0, 0, 1, 2, 3, 3});
+}
+
+TEST_CASE("Parallel contagion matches the sequential one") {
+  std::mt19937 generator(42);
+  std::uniform_int_distribution<unsigned int> person(0, 19999);
+  tp::population population(20000);
+
+  for (unsigned int i = 0; i < 4000; i++) {
+    population.add_infected(person(generator));
+  }
+
+  for (unsigned int i = 0; i < 60000; i++) {
+    auto a = person(generator), b = person(generator);
+    if (a != b) {
+      population.add_relation({std::min(a, b), std::max(a, b)});
+    }
+  }
+
+  tp::contagion contagion(population);
+  std::vector<bool> isolated(contagion.relation_count(), false);
+  for (tp::type::relation_id id = 0; id < isolated.size(); id += 3) {
+    isolated[id] = true;
+  }
+
+  for (unsigned int virality = 1; virality < 4; virality++) {
+    std::vector<unsigned int> rounds;
+    std::vector<unsigned int> parallel_rounds;
+
+    auto infected = contagion.run(virality, isolated, &rounds);
+    REQUIRE(contagion.run_parallel(virality, isolated, &parallel_rounds) == infected);
+    REQUIRE(parallel_rounds == rounds);
+  }
+}
+
+TEST_CASE("Dense contagion matches the sparse one") {
+  std::mt19937 generator(7);
+  std::uniform_int_distribution<unsigned int> person(0, 299);
+  tp::population population(300);
+
+  for (unsigned int i = 0; i < 10; i++) {
+    population.add_infected(person(generator));
+  }
+
+  for (unsigned int i = 0; i < 20000; i++) {
+    auto a = person(generator), b = person(generator);
+    if (a != b) {
+      population.add_relation({std::min(a, b), std::max(a, b)});
+    }
+  }
+
+  tp::contagion sparse(population, tp::contagion::backend::sparse);
+  tp::contagion dense(population);
+  REQUIRE(!sparse.dense());
+  REQUIRE(dense.dense());
+
+  std::vector<bool> isolated(sparse.relation_count(), false);
+  for (tp::type::relation_id id = 0; id < isolated.size(); id += 2) {
+    isolated[id] = true;
+  }
+
+  for (unsigned int virality = 0; virality < 12; virality++) {
+    std::vector<unsigned int> sparse_rounds;
+    std::vector<unsigned int> dense_rounds;
+
+    auto infected = sparse.run(virality, isolated, &sparse_rounds);
+    REQUIRE(dense.run(virality, isolated, &dense_rounds) == infected);
+    REQUIRE(dense_rounds == sparse_rounds);
+  }
+}
+
+TEST_CASE("Contagion stops once the limit is exceeded") {
+  tp::population population = create_population();
+  tp::contagion sparse(population, tp::contagion::backend::sparse);
+  tp::contagion dense(population, tp::contagion::backend::dense);
+
+  std::vector<tp::type::relations> isolations{
+    {}, {{3, 5}}, {{3, 4}, {3, 5}}, {{2, 3}, {3, 4}, {3, 5}}, {{0, 2}, {1, 2}},
+  };
+
+  for (unsigned int virality = 0; virality < 4; virality++) {
+    for (const auto& isolation : isolations) {
+      auto isolated = sparse.isolated(isolation);
+      auto infected = sparse.run(virality, isolated);
+
+      for (unsigned int limit = 0; limit < 7; limit++) {
+        REQUIRE(sparse.exceeds(virality, isolated, limit) == (infected > limit));
+        REQUIRE(sparse.exceeds(virality, isolated, limit, true) == (infected > limit));
+        REQUIRE(dense.exceeds(virality, isolated, limit) == (infected > limit));
+      }
+    }
+  }
+}
@@ -0,0 +1,63 @@
+#include <catch.hpp>
+#include <criteria.hpp>
+
+TEST_CASE("Criteria without limits never stops") {
+  tp::criteria criteria;
+  criteria.start();
+
+  for (auto i = 0; i < 100; i++) {
+    criteria.next_generation(false);
+  }
+
+  REQUIRE(!criteria.done({}));
+  REQUIRE(!criteria.done(0));
+}
+
+TEST_CASE("Criteria stops after the maximum number of generations") {
+  tp::criteria criteria;
+  criteria.set_max_generations(3);
+  criteria.start();
+
+  criteria.next_generation(true);
+  criteria.next_generation(true);
+  REQUIRE(!criteria.done({}));
+
+  criteria.next_generation(true);
+  REQUIRE(criteria.done({}));
+  REQUIRE(criteria.generation() == 3);
+}
+
+TEST_CASE("Criteria stops once the target cost is reached") {
+  tp::criteria criteria;
+  criteria.set_target_cost(10);
+  criteria.start();
+
+  REQUIRE(!criteria.done({}));
+  REQUIRE(!criteria.done(11));
+  REQUIRE(criteria.done(10));
+  REQUIRE(criteria.done(9));
+}
+
+TEST_CASE("Criteria stops after stagnating generations") {
+  tp::criteria criteria;
+  criteria.set_stagnation(2);
+  criteria.start();
+
+  criteria.next_generation(false);
+  criteria.next_generation(true);
+  criteria.next_generation(false);
+  REQUIRE(!criteria.done({}));
+
+  criteria.next_generation(false);
+  REQUIRE(criteria.done({}));
+}
+
+TEST_CASE("Criteria stops once the lower bound is reached") {
+  tp::criteria criteria;
+  criteria.set_lower_bound(5);
+  criteria.start();
+
+  REQUIRE(!criteria.done(6));
+  REQUIRE(criteria.done(5));
+  REQUIRE(criteria.lower_bound() == 5);
+}
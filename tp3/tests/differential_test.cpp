@@ -0,0 +1,49 @@
+#include <catch.hpp>
+#include <differential.hpp>
+
+#include <cstdint>
+#include <optional>
+#include <random>
+#include <vector>
+
+TEST_CASE("Contagion backends match population::run on random cases") {
+  std::mt19937 generator(11);
+
+  for (unsigned int i = 0; i < 300; i++) {
+    auto simulation = tp::differential::random_case(generator, 40);
+    REQUIRE(tp::differential::check(simulation) == std::nullopt);
+  }
+}
+
+TEST_CASE("Contagion backends match population::run on fuzzer bytes") {
+  std::mt19937 generator(5);
+  std::uniform_int_distribution<unsigned int> byte(0, 255);
+
+  for (unsigned int i = 0; i < 300; i++) {
+    std::vector<std::uint8_t> data(byte(generator));
+    for (auto& value : data) {
+      value = byte(generator);
+    }
+
+    auto simulation = tp::differential::from_bytes(data.data(), data.size());
+    REQUIRE(tp::differential::check(simulation) == std::nullopt);
+  }
+}
+
+TEST_CASE("Failing cases are shrunk to a minimal one") {
+  std::mt19937 generator(2);
+  auto simulation = tp::differential::random_case(generator, 30);
+  while (simulation.relations.size() < 5 || simulation.infected.empty()) {
+    simulation = tp::differential::random_case(generator, 30);
+  }
+
+  // fails whenever three relations and an infected person are left
+  auto shrunk = tp::differential::shrink(simulation, [] (const auto& candidate) {
+    return candidate.relations.size() >= 3 && !candidate.infected.empty();
+  });
+
+  REQUIRE(shrunk.relations.size() == 3);
+  REQUIRE(shrunk.infected.size() == 1);
+  REQUIRE(shrunk.isolations.empty());
+  REQUIRE(shrunk.virality == 0);
+}
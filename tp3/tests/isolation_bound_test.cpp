@@ -0,0 +1,50 @@
+#include <catch.hpp>
+#include <isolation_bound.hpp>
+#include <population.hpp>
+#include <settings.hpp>
+
+static
+tp::population create_population() {
+  tp::population pop(6);
+
+  pop.add_infected(0);
+  pop.add_infected(1);
+
+  pop.add_relation({0, 2});
+  pop.add_relation({0, 3});
+  pop.add_relation({1, 2});
+  pop.add_relation({1, 5});
+  pop.add_relation({2, 3});
+  pop.add_relation({2, 4});
+  pop.add_relation({3, 4});
+  pop.add_relation({3, 5});
+
+  return pop;
+}
+
+TEST_CASE("Isolation bound is zero when the first round stays under the limit") {
+  tp::population population = create_population();
+  tp::settings settings(2);
+  tp::isolation_bound bound(settings, population);
+
+  REQUIRE(bound.compute() == 0);
+}
+
+TEST_CASE("Isolation bound counts the cheapest persons to protect") {
+  tp::population population = create_population();
+  tp::settings settings(1);
+  tp::isolation_bound bound(settings, population);
+
+  REQUIRE(bound.compute() == 2);
+}
+
+TEST_CASE("Isolation bound reports impossible instances") {
+  tp::population population = create_population();
+  population.add_infected(2);
+  population.add_infected(3);
+
+  tp::settings settings(2);
+  tp::isolation_bound bound(settings, population);
+
+  REQUIRE(bound.compute() == std::nullopt);
+}
@@ -0,0 +1,95 @@
+#include <catch.hpp>
+#include <contagion.hpp>
+#include <memory.hpp>
+#include <population.hpp>
+#include <relation_set.hpp>
+
+#include <memory>
+#include <new>
+#include <thread>
+#include <vector>
+
+TEST_CASE("Allocations are counted") {
+  auto before = tp::memory::allocations();
+  auto allocated = std::make_unique<std::vector<int>>(100);
+  auto counted = tp::memory::allocations() - before;
+
+  REQUIRE(counted.count >= 2);
+  REQUIRE(counted.bytes >= 100 * sizeof(int));
+
+  allocated.reset();
+  REQUIRE((tp::memory::allocations() - before).frees >= 2);
+  REQUIRE(tp::memory::peak_rss() > 0);
+}
+
+TEST_CASE("Allocations of every thread are counted") {
+  struct alignas(128) aligned {
+    char data[128];
+  };
+
+  // direct calls to the operators, unlike new expressions, cannot be elided
+  // by an optimizing compiler
+  auto before = tp::memory::allocations();
+  std::thread([] {
+    void* allocated = ::operator new(1000 * sizeof(int));
+    void* over_aligned = ::operator new(sizeof(aligned), std::align_val_t{alignof(aligned)});
+    ::operator delete(over_aligned, std::align_val_t{alignof(aligned)});
+    ::operator delete(allocated);
+  }).join();
+  auto counted = tp::memory::allocations() - before;
+
+  REQUIRE(counted.bytes >= 1000 * sizeof(int) + sizeof(aligned));
+  REQUIRE(counted.frees >= 2);
+}
+
+TEST_CASE("Footprints grow with the structures") {
+  tp::population small(100);
+  tp::population large(100);
+  for (unsigned int i = 0; i < 50; i++) {
+    large.add_relation({i, i + 1});
+  }
+
+  REQUIRE(large.footprint() > small.footprint());
+  REQUIRE(tp::memory::format(512) == "512 B");
+  REQUIRE(tp::memory::format(3 * 1024 * 1024) == "3.0 MiB");
+}
+
+TEST_CASE("Shared isolation chunks are counted once") {
+  tp::type::relations relations;
+  for (unsigned int i = 0; i < 1000; i++) {
+    relations.insert({i, i + 1});
+  }
+
+  tp::relation_set parent(relations);
+  tp::relation_set child(parent);
+  child.insert({0, 2});
+
+  auto shared = tp::relation_set::footprint({&parent, &child});
+  REQUIRE(shared > parent.footprint());
+  REQUIRE(shared < parent.footprint() + child.footprint());
+}
+
+TEST_CASE("Contagion footprints are known before building") {
+  tp::population sparse(1000);
+  for (unsigned int i = 0; i < 999; i++) {
+    sparse.add_relation({i, i + 1});
+  }
+  sparse.add_infected(0);
+  sparse.add_infected(500);
+
+  tp::population dense(40);
+  for (unsigned int i = 0; i < 40; i++) {
+    for (unsigned int j = i + 1; j < 40; j += 2) {
+      dense.add_relation({i, j});
+    }
+  }
+  dense.add_infected(3);
+
+  for (const auto* pop : {&sparse, &dense}) {
+    tp::contagion contagion(*pop);
+    REQUIRE(tp::contagion::footprint(*pop) == contagion.footprint());
+  }
+
+  REQUIRE(tp::contagion(dense).dense());
+  REQUIRE(!tp::contagion(sparse).dense());
+}
@@ -0,0 +1,49 @@
+#include <catch.hpp>
+#include <operator_rates.hpp>
+#include <settings.hpp>
+
+TEST_CASE("Operator rates start from the configured counts") {
+  tp::settings settings(2);
+  settings.set_cross_count(5);
+  settings.set_mutation_count(40);
+
+  tp::operator_rates rates(settings);
+  REQUIRE(rates.cross_count() == 5);
+  REQUIRE(rates.mutation_count() == 40);
+}
+
+TEST_CASE("Operator rates move the budget toward the successful operator") {
+  tp::settings settings(2);
+  settings.set_cross_count(10);
+  settings.set_mutation_count(100);
+
+  tp::operator_rates rates(settings);
+  for (auto i = 0; i < 20; i++) {
+    rates.update(2 * rates.cross_count(), 2 * rates.cross_count(), rates.mutation_count(), 0);
+  }
+
+  REQUIRE(rates.cross_count() > 10);
+  REQUIRE(rates.mutation_count() < 100);
+  REQUIRE(rates.mutation_count() >= 12);
+  REQUIRE(2 * rates.cross_count() + rates.mutation_count() == 120);
+}
+
+TEST_CASE("Operator rates keep the counts within a small budget") {
+  tp::settings settings(2);
+  settings.set_cross_count(0);
+  settings.set_mutation_count(1);
+
+  tp::operator_rates rates(settings);
+  rates.update(0, 0, 1, 1);
+  REQUIRE(rates.cross_count() == 0);
+  REQUIRE(rates.mutation_count() == 1);
+
+  settings.set_cross_count(1);
+  tp::operator_rates shared(settings);
+  for (auto i = 0; i < 20; i++) {
+    shared.update(2, 2, 1, 0);
+  }
+
+  REQUIRE(shared.cross_count() == 1);
+  REQUIRE(shared.mutation_count() == 1);
+}
@@ -0,0 +1,50 @@
+#include <catch.hpp>
+#include <population.hpp>
+#include <relation_set.hpp>
+
+#include <random>
+#include <vector>
+
+TEST_CASE("Relation set behaves like a set of relations") {
+  std::mt19937 generator(3);
+  std::uniform_int_distribution<unsigned int> person(0, 99);
+
+  tp::type::relations expected;
+  tp::relation_set set;
+
+  for (unsigned int i = 0; i < 5000; i++) {
+    tp::type::relation relation{person(generator), person(generator)};
+    if (generator() % 3 == 0) {
+      REQUIRE(set.erase(relation) == (expected.erase(relation) == 1));
+    } else {
+      REQUIRE(set.insert(relation) == expected.insert(relation).second);
+    }
+  }
+
+  REQUIRE(set.size() == expected.size());
+  REQUIRE(set == expected);
+  REQUIRE(set.relations() == expected);
+  REQUIRE(set.contains(*expected.begin()));
+  REQUIRE(set.nth(0) == *expected.begin());
+  REQUIRE(set.nth(expected.size() - 1) == *expected.rbegin());
+  REQUIRE(tp::relation_set(expected) == set);
+  REQUIRE(tp::relation_set::from_sorted(std::vector<tp::type::relation>(expected.begin(), expected.end())) == set);
+}
+
+TEST_CASE("Relation set copies share their unchanged chunks") {
+  tp::type::relations relations;
+  for (unsigned int i = 0; i < 1000; i++) {
+    relations.insert({i, i + 1});
+  }
+
+  tp::relation_set parent(relations);
+  tp::relation_set child(parent);
+  REQUIRE(child.shared_chunks(parent) == parent.chunk_count());
+
+  child.erase({10, 11});
+  child.insert({500, 502});
+  REQUIRE(child.shared_chunks(parent) == parent.chunk_count() - 2);
+  REQUIRE(parent == relations);
+  REQUIRE(!child.contains({10, 11}));
+  REQUIRE(child.contains({500, 502}));
+}
@@ -0,0 +1,87 @@
+#include <catch.hpp>
+#include <server.hpp>
+#include <settings.hpp>
+
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+#include <chrono>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <optional>
+#include <string>
+#include <thread>
+
+static
+int connect_to(const std::filesystem::path& path) {
+  sockaddr_un address{};
+  address.sun_family = AF_UNIX;
+  std::strncpy(address.sun_path, path.c_str(), sizeof(address.sun_path) - 1);
+
+  for (unsigned int attempt = 0; attempt < 500; attempt++) {
+    int fd = socket(AF_UNIX, SOCK_STREAM, 0);
+    if (connect(fd, (sockaddr*) &address, sizeof(address)) == 0) {
+      return fd;
+    }
+
+    close(fd);
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+  }
+
+  return -1;
+}
+
+static
+std::string request(int fd, const std::string& command) {
+  std::string data = command + "\n";
+  send(fd, data.data(), data.size(), MSG_NOSIGNAL);
+
+  std::string reply;
+  char c;
+  while (read(fd, &c, 1) == 1 && c != '\n') {
+    reply.push_back(c);
+  }
+
+  return reply;
+}
+
+TEST_CASE("Server rejects persons and viralities out of range") {
+  auto dataset = std::filesystem::temp_directory_path() / "pandemic_server_test.txt";
+  auto socket_path = std::filesystem::temp_directory_path() / "pandemic_server_test.sock";
+  {
+    std::ofstream file(dataset);
+    file << "4 1\n0 1 0 0\n1 0 1 0\n0 1 0 1\n0 0 1 0\n0\n";
+  }
+
+  tp::settings settings(1);
+  tp::server server(settings, 1);
+  std::optional<std::string> error;
+  std::thread serving([&] { error = server.serve(socket_path); });
+
+  int fd = connect_to(socket_path);
+  REQUIRE(fd >= 0);
+
+  REQUIRE(request(fd, "load p " + dataset.string()) == "ok");
+  REQUIRE(request(fd, "infected p 4") == "error person out of range");
+  REQUIRE(request(fd, "infected p 4294967295") == "error person out of range");
+  REQUIRE(request(fd, "infected p -1") == "error person out of range");
+  REQUIRE(request(fd, "infected p 1x") == "error person out of range");
+  REQUIRE(request(fd, "infected p 3") == "ok");
+  REQUIRE(request(fd, "solve p -1 1") == "error invalid virality");
+  REQUIRE(request(fd, "solve p 1 1 greedy") == "ok");
+
+  std::string reply;
+  do {
+    reply = request(fd, "");
+  } while (reply.rfind("done", 0) != 0 && !reply.empty());
+  REQUIRE(reply == "done 1");
+
+  close(fd);
+  server.stop();
+  serving.join();
+  std::filesystem::remove(dataset);
+
+  REQUIRE(error == std::nullopt);
+}
@@ -0,0 +1,56 @@
+#include <catch.hpp>
+#include <settings.hpp>
+
+#include <thread>
+#include <vector>
+
+static
+std::vector<unsigned int> draws(tp::settings& settings, unsigned int count) {
+  std::vector<unsigned int> values;
+  for (unsigned int i = 0; i < count; i++) {
+    values.push_back(settings.random_to(1000000));
+  }
+
+  return values;
+}
+
+TEST_CASE("Seeded streams do not depend on the thread drawing them") {
+  tp::settings settings(2);
+  settings.set_seed(42);
+
+  std::vector<unsigned int> main_draws;
+  {
+    tp::settings::stream stream(settings, 3, 7);
+    main_draws = draws(settings, 16);
+  }
+
+  std::vector<unsigned int> thread_draws;
+  std::thread([&] {
+    draws(settings, 5);
+    tp::settings::stream stream(settings, 3, 7);
+    thread_draws = draws(settings, 16);
+  }).join();
+
+  REQUIRE(main_draws == thread_draws);
+
+  tp::settings::stream other(settings, 3, 8);
+  REQUIRE(draws(settings, 16) != main_draws);
+}
+
+TEST_CASE("Seeded streams give back the generator of the thread") {
+  tp::settings settings(2);
+  settings.set_seed(42);
+
+  tp::settings reference(2);
+  reference.set_seed(42);
+
+  auto first = draws(settings, 4);
+  {
+    tp::settings::stream stream(settings, 0, 0);
+    draws(settings, 100);
+  }
+  auto second = draws(settings, 4);
+
+  first.insert(first.end(), second.begin(), second.end());
+  REQUIRE(first == draws(reference, 8));
+}
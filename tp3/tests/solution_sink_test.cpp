@@ -0,0 +1,42 @@
+#include <catch.hpp>
+#include <population.hpp>
+#include <solution.hpp>
+#include <solution_sink.hpp>
+
+#include <filesystem>
+#include <variant>
+
+TEST_CASE("Solutions are formatted one isolation per line") {
+  REQUIRE(tp::solution_sink::format({}) == "");
+  REQUIRE(tp::solution_sink::format(tp::type::relations{{0, 12}, {3, 4294967295}}) == "0 12\n3 4294967295\n");
+}
+
+TEST_CASE("Solution sink keeps the latest solution") {
+  auto path = std::filesystem::temp_directory_path() / "pandemic_sink_test.txt";
+  std::filesystem::remove(path);
+
+  tp::type::relations isolations;
+  {
+    tp::solution_sink sink(path);
+    for (unsigned int i = 0; i < 200; i++) {
+      isolations.insert({i, i + 1});
+      sink.submit(isolations.size(), isolations);
+    }
+
+    REQUIRE(sink.close() == std::nullopt);
+    REQUIRE(sink.written() >= 1);
+    REQUIRE(sink.written() <= 200);
+  }
+
+  auto written = tp::solution::from_file(path);
+  std::filesystem::remove(path);
+  REQUIRE(written.index() == 0);
+  REQUIRE(std::get<tp::solution>(written).relations() == isolations);
+  REQUIRE(!std::filesystem::exists(path.string() + ".tmp"));
+}
+
+TEST_CASE("Solution sink reports write failures") {
+  tp::solution_sink sink("/nonexistent/directory/solution.txt");
+  sink.submit(1, tp::type::relations{{0, 1}});
+  REQUIRE(sink.close() != std::nullopt);
+}
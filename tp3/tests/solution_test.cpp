@@ -0,0 +1,72 @@
+#include <catch.hpp>
+#include <contagion.hpp>
+#include <population.hpp>
+#include <solution.hpp>
+
+#include <sstream>
+#include <string>
+#include <variant>
+
+static
+tp::population create_population() {
+  tp::population pop(6);
+
+  pop.add_infected(0);
+  pop.add_infected(1);
+
+  pop.add_relation({0, 2});
+  pop.add_relation({0, 3});
+  pop.add_relation({1, 2});
+  pop.add_relation({1, 5});
+  pop.add_relation({2, 3});
+  pop.add_relation({2, 4});
+  pop.add_relation({3, 4});
+  pop.add_relation({3, 5});
+
+  return pop;
+}
+
+static
+std::variant<tp::solution, std::string> parse(const std::string& content) {
+  std::istringstream input(content);
+  return tp::solution::parse(input);
+}
+
+TEST_CASE("Solution keeps the last printed solution") {
+  auto parsed = parse("\n0 2\n0 3\n\n2 3\n4 3\n3 5\n\n");
+  REQUIRE(parsed.index() == 0);
+  REQUIRE(std::get<tp::solution>(parsed).isolations() == std::vector<tp::type::relation>{{2, 3}, {4, 3}, {3, 5}});
+
+  tp::type::relations relations{{2, 3}, {3, 4}, {3, 5}};
+  REQUIRE(std::get<tp::solution>(parsed).relations() == relations);
+
+  auto invalid = parse("0 2\n3\n");
+  REQUIRE(invalid.index() == 1);
+  REQUIRE(std::get<std::string>(invalid) == "line 2: expected 'i j'");
+
+  auto too_large = parse("0 2\n4294967298 3\n");
+  REQUIRE(too_large.index() == 1);
+  REQUIRE(std::get<std::string>(too_large) == "line 2: person out of range");
+}
+
+TEST_CASE("Solution is verified by simulating the propagation") {
+  tp::population population = create_population();
+  tp::contagion contagion(population);
+
+  auto valid = std::get<tp::solution>(parse("2 3\n4 3\n5 3\n")).verify(contagion, 2);
+  REQUIRE(valid.valid);
+  REQUIRE(valid.cost == 3);
+  REQUIRE(valid.infected_percent == population.run(2, {{2, 3}, {3, 4}, {3, 5}}));
+
+  auto infected = std::get<tp::solution>(parse("3 5\n")).verify(contagion, 2);
+  REQUIRE(!infected.valid);
+  REQUIRE(infected.infected_percent > 50);
+
+  auto missing = std::get<tp::solution>(parse("4 5\n")).verify(contagion, 2);
+  REQUIRE(!missing.valid);
+  REQUIRE(missing.reason == "relation (4, 5) does not exist");
+
+  auto repeated = std::get<tp::solution>(parse("2 3\n4 3\n5 3\n3 2\n")).verify(contagion, 2);
+  REQUIRE(!repeated.valid);
+  REQUIRE(repeated.reason == "relation (3, 2) is isolated twice");
+}
@@ -0,0 +1,55 @@
+#include <catch.hpp>
+#include <thread_pinning.hpp>
+
+#include <tbb/parallel_for.h>
+#include <tbb/task_arena.h>
+
+#include <pthread.h>
+#include <sched.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <vector>
+
+TEST_CASE("Cores are listed from a CPU set") {
+  cpu_set_t set;
+  CPU_ZERO(&set);
+  REQUIRE(tp::thread_pinning::cores(set).empty());
+
+  CPU_SET(1, &set);
+  CPU_SET(3, &set);
+  CPU_SET(CPU_SETSIZE - 1, &set);
+  REQUIRE(tp::thread_pinning::cores(set) == std::vector<int>{1, 3, CPU_SETSIZE - 1});
+}
+
+TEST_CASE("Threads joining an arena are pinned to an allowed core") {
+  cpu_set_t allowed;
+  CPU_ZERO(&allowed);
+  REQUIRE(sched_getaffinity(0, sizeof(allowed), &allowed) == 0);
+  auto allowed_cores = tp::thread_pinning::cores(allowed);
+
+  std::atomic_bool pinned = true;
+  {
+    tbb::task_arena arena(tbb::this_task_arena::max_concurrency());
+    tp::thread_pinning thread_pinning;
+    REQUIRE(thread_pinning.core_count() == allowed_cores.size());
+
+    arena.execute([&] {
+      tbb::parallel_for(std::size_t(0), std::size_t(64), [&] (std::size_t) {
+        cpu_set_t current;
+        CPU_ZERO(&current);
+        pthread_getaffinity_np(pthread_self(), sizeof(current), &current);
+
+        auto cores = tp::thread_pinning::cores(current);
+        if (cores.size() != 1 || std::find(allowed_cores.begin(), allowed_cores.end(), cores[0]) == allowed_cores.end()) {
+          pinned = false;
+        }
+      });
+    });
+  }
+
+  // the observer pinned this thread too, the next tests may use every core
+  pthread_setaffinity_np(pthread_self(), sizeof(allowed), &allowed);
+  REQUIRE(pinned);
+}